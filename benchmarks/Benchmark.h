@@ -0,0 +1,52 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+
+/* Timing shared by the runtime benchmarks */
+#ifndef ENUM_HELPER_BENCHMARK_H
+#define ENUM_HELPER_BENCHMARK_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <type_traits>
+
+/* Every measured loop that returns a value adds it here, so none of them can be optimised away.
+   Loops that return nothing have to store their results where the benchmark reads them later */
+static volatile size_t sink;
+
+template <typename Function>
+void runMeasured(Function &function, std::true_type /* returns nothing */)
+{
+    function();
+}
+
+template <typename Function>
+void runMeasured(Function &function, std::false_type)
+{
+    sink = sink + function();
+}
+
+/* Average over 20 rounds of function, which does operations operations per round */
+template <typename Function>
+double nanosecondsPerOperation(size_t operations, Function function)
+{
+    const int rounds = 20;
+    const auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round)
+    {
+        runMeasured(function, std::is_void<decltype(function())>());
+    }
+    const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / rounds / operations;
+}
+
+inline void report(const char *name, const char *operation, double nanoseconds)
+{
+    printf("%-10s %-18s %8.2f ns/op %10.1f Mop/s\n", name, operation, nanoseconds, 1000.0 / nanoseconds);
+}
+
+#endif
@@ -0,0 +1,75 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#include "EnumHelper.h"
+#include "Benchmark.h"
+#include <cstdio>
+#include <random>
+#include <vector>
+
+EnumHelper(Color, Red = 23, Blue, Green, Purple, Red1 = 100, Blue1, Green1, Purple1, Red2, Blue2, Green2, Purple2 = 100 + 100);
+EnumHelper(Sparse, S0 = 3, S1 = 170, S2 = 1021, S3 = 4000, S4 = 9999, S5 = 12345, S6 = 50000, S7 = 77777, S8 = 100003, S9 = 262144);
+
+template <typename EnumType, typename Table>
+static void benchmark(const char *name, const Table &table)
+{
+    const size_t elements = 1 << 16;
+    std::mt19937 random(42);
+    std::vector<EnumType> values(elements);
+    std::vector<const char *> names(elements);
+    for (size_t element = 0; element < elements; ++element)
+    {
+        /* Every eighth element misses */
+        values[element] = (element % 8 == 7) ? static_cast<EnumType>(-1) : table.at(random() % (table.end() - table.begin())).getValue();
+        names[element] = (element % 8 == 7) ? "NoSuchName" : table.at(random() % (table.end() - table.begin())).toString();
+    }
+    std::vector<const char *> stringified(elements);
+    std::vector<EnumType> parsed(elements);
+    std::vector<std::uint64_t> errors((elements + 63) / 64);
+
+    const double loopToString = nanosecondsPerOperation(elements, [&]() {
+        for (size_t element = 0; element < elements; ++element)
+        {
+            stringified[element] = table(values[element]).toString();
+        }
+    });
+    const double bulkToString = nanosecondsPerOperation(elements, [&]() { table.namesOf(values.data(), elements, stringified.data()); });
+    const double loopParse = nanosecondsPerOperation(elements, [&]() {
+        for (size_t element = 0; element < elements; ++element)
+        {
+            parsed[element] = table(names[element]).getValue();
+        }
+    });
+    const double bulkParse = nanosecondsPerOperation(elements, [&]() { table.valuesOf(names.data(), elements, parsed.data(), errors.data()); });
+    std::vector<unsigned char> wire(elements * table.ordinalBytes());
+    const double loopEncode = nanosecondsPerOperation(elements, [&]() {
+        unsigned char *position = wire.data();
+        for (size_t element = 0; element < elements; ++element)
+        {
+            position = table.encode(values[element], position, wire.data() + wire.size());
+        }
+    });
+    const double bulkEncode = nanosecondsPerOperation(elements, [&]() { table.encodeAll(values.data(), elements, wire.data()); });
+    const double loopDecode = nanosecondsPerOperation(elements, [&]() {
+        const unsigned char *position = wire.data();
+        for (size_t element = 0; element < elements; ++element)
+        {
+            position = table.decode(position, wire.data() + wire.size(), parsed[element]);
+        }
+    });
+    const double bulkDecode = nanosecondsPerOperation(elements, [&]() { table.decodeAll(wire.data(), elements, parsed.data()); });
+
+    printf("%-8s value->name  loop %6.2f ns  bulk %6.2f ns\n", name, loopToString, bulkToString);
+    printf("%-8s name->value  loop %6.2f ns  bulk %6.2f ns\n", name, loopParse, bulkParse);
+    printf("%-8s encode       loop %6.2f ns  bulk %6.2f ns\n", name, loopEncode, bulkEncode);
+    printf("%-8s decode       loop %6.2f ns  bulk %6.2f ns\n", name, loopDecode, bulkDecode);
+}
+
+int main(int, char *[])
+{
+    benchmark<Color>("Color", ColorMagicEnum);
+    benchmark<Sparse>("Sparse", SparseMagicEnum);
+}
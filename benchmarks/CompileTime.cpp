@@ -0,0 +1,132 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* Set by CMake, so the generated sources are built by the same compiler as the examples */
+#ifndef ENUM_HELPER_CXX
+#define ENUM_HELPER_CXX "c++"
+#endif
+#ifndef ENUM_HELPER_INCLUDE_DIR
+#define ENUM_HELPER_INCLUDE_DIR "include"
+#endif
+
+struct CompileResult
+{
+    bool ok;
+    double seconds;
+    long peakKilobytes;
+    long objectBytes;
+};
+
+/* Both headers declare an enum the same way, so one source serves both */
+static void writeSource(const std::string &path, const char *header, size_t enumerators)
+{
+    FILE *file = fopen(path.c_str(), "w");
+    if (enumerators >= 256)
+    {
+        /* Invalid is appended, so 256 enumerators already need the 1024 map */
+        fprintf(file, "#define ENUM_HELPER_MAX_ENUMERATORS 1024\n");
+    }
+    fprintf(file, "#include \"%s\"\n\nint main(int, char *[])\n{\n    EnumHelper(Color", header);
+    for (size_t enumerator = 0; enumerator < enumerators; ++enumerator)
+    {
+        fprintf(file, (enumerator % 10 == 0) ? ", E%zu = %zu" : ", E%zu", enumerator, enumerator * 2);
+    }
+    fprintf(file, ");\n    size_t sum = 0;\n    for (auto const &color : ColorMagicEnum)\n    {\n        sum += color.getIntValue();\n    }\n");
+    fprintf(file, "    return (ColorMagicEnum(\"E%zu\").getIntValue() + sum) == 0;\n}\n", enumerators - 1);
+    fclose(file);
+}
+
+/* wait4 gives the peak RSS of the compiler itself, not of this process */
+static CompileResult compile(const std::string &source, const std::string &object, int standard)
+{
+    const std::string standardFlag = "-std=gnu++" + std::to_string(standard);
+    const char *arguments[] = {ENUM_HELPER_CXX, standardFlag.c_str(), "-Wall", "-Wextra", "-pedantic-errors", "-fconstexpr-depth=200",
+                               "-I" ENUM_HELPER_INCLUDE_DIR, "-c", source.c_str(), "-o", object.c_str(), nullptr};
+    CompileResult result = {false, 0.0, 0, 0};
+    unlink(object.c_str());
+
+    const auto start = std::chrono::steady_clock::now();
+    const pid_t child = fork();
+    if (child == 0)
+    {
+        const int null = open("/dev/null", O_WRONLY);
+        dup2(null, STDERR_FILENO);
+        execvp(arguments[0], const_cast<char *const *>(arguments));
+        _exit(127);
+    }
+    int status = 0;
+    struct rusage usage = {};
+    if (child < 0 || wait4(child, &status, 0, &usage) != child)
+    {
+        return result;
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    struct stat objectStat = {};
+    result.ok = WIFEXITED(status) && WEXITSTATUS(status) == 0 && stat(object.c_str(), &objectStat) == 0;
+    result.seconds = elapsed.count();
+    result.peakKilobytes = usage.ru_maxrss;
+    result.objectBytes = result.ok ? static_cast<long>(objectStat.st_size) : 0;
+    return result;
+}
+
+/* Usage: compile_benchmark [enumerators...], defaults to 10 100 500 1000. Exits with 1 when any case fails to compile */
+int main(int argc, char *argv[])
+{
+    std::vector<size_t> sizes = {10, 100, 500, 1000};
+    if (argc > 1)
+    {
+        sizes.clear();
+        for (int argument = 1; argument < argc; ++argument)
+        {
+            sizes.push_back(strtoul(argv[argument], nullptr, 10));
+        }
+    }
+    const char *headers[] = {"EnumHelper.h", "EnumHelperWithoutMacroMagic.h"};
+    const int standards[] = {11, 17, 20};
+
+    char directory[] = "/tmp/enum_helper_compile_XXXXXX";
+    if (mkdtemp(directory) == nullptr)
+    {
+        perror("mkdtemp");
+        return 1;
+    }
+
+    int failures = 0;
+    printf("%-30s %-6s %6s %-6s %9s %10s %11s\n", "header", "std", "enums", "result", "seconds", "peak MB", "object KB");
+    for (const char *header : headers)
+    {
+        for (int standard : standards)
+        {
+            for (size_t enumerators : sizes)
+            {
+                const std::string source = std::string(directory) + "/generated.cpp";
+                const std::string object = std::string(directory) + "/generated.o";
+                writeSource(source, header, enumerators);
+                const CompileResult result = compile(source, object, standard);
+                failures += result.ok ? 0 : 1;
+                printf("%-30s c++%-3d %6zu %-6s %9.2f %10.1f %11.1f\n", header, standard, enumerators, result.ok ? "ok" : "failed",
+                       result.seconds, result.peakKilobytes / 1024.0, result.objectBytes / 1024.0);
+                fflush(stdout);
+                unlink(source.c_str());
+                unlink(object.c_str());
+            }
+        }
+    }
+    rmdir(directory);
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#define ENUM_HELPER_REGISTRY
+#include "EnumHelper.h"
+#include "EnumDictionary.h"
+#include "Benchmark.h"
+#include <cstdio>
+#include <random>
+#include <vector>
+
+EnumHelper(Opcode, Load = 3, Store = 17, Add = 40, Subtract = 41, Multiply = 90, Divide = 91, Jump = 200, Branch = 201, Call = 350,
+           Return = 351, Push = 600, Pop = 601, Nop = 1000, Halt = 4000);
+
+/* A decoder sees raw integers, the dictionary turns them back into names without the enum being compiled in */
+int main(int, char *[])
+{
+    const size_t operations = 1 << 16;
+    std::vector<unsigned char> bytes(EnumHelper::writeDictionary(nullptr, nullptr));
+    EnumHelper::writeDictionary(bytes.data(), bytes.data() + bytes.size());
+    EnumHelper::EnumDictionary dictionary;
+    if (!dictionary.attach(bytes.data(), bytes.size()))
+    {
+        return 1;
+    }
+
+    std::mt19937 random(42);
+    std::vector<long long> values(operations);
+    for (size_t operation = 0; operation < operations; ++operation)
+    {
+        values[operation] = OpcodeMagicEnum.at(random() % (OpcodeMagicEnum.end() - OpcodeMagicEnum.begin())).getIntValue();
+    }
+
+    const double inBinary = nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += *OpcodeMagicEnum(static_cast<Opcode>(values[operation])).toString();
+        }
+        return sum;
+    });
+    const double perValue = nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += *dictionary.nameOf("Opcode", values[operation]);
+        }
+        return sum;
+    });
+    const double perEnum = nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        const EnumHelper::EnumDictionary::Enum opcode = dictionary.find("Opcode");
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += *opcode.nameOf(values[operation]);
+        }
+        return sum;
+    });
+
+    printf("dictionary %zu bytes\n", bytes.size());
+    printf("decode  in binary %8.2f ns  find per value %8.2f ns  find once %8.2f ns\n", inBinary, perValue, perEnum);
+}
@@ -0,0 +1,55 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#include "EnumHelper.h"
+#include "Benchmark.h"
+#include <cstdio>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+EnumHelper(Opcode, Load = 3, Store = 17, Add = 40, Subtract = 41, Multiply = 90, Divide = 91, Jump = 200, Branch = 201, Call = 350,
+           Return = 351, Push = 600, Pop = 601, Nop = 1000, Halt = 4000);
+/* The same values with the direct value index, which EnumMap needs for a sparse enum */
+EnumHelperLookup(Dense, DenseOpcode, Load = 3, Store = 17, Add = 40, Subtract = 41, Multiply = 90, Divide = 91, Jump = 200, Branch = 201,
+                 Call = 350, Return = 351, Push = 600, Pop = 601, Nop = 1000, Halt = 4000);
+
+/* The same counting dispatch through each container, the map is passed by reference so it is not folded */
+template <typename Map, typename EnumType>
+static double countAll(Map &counters, const std::vector<EnumType> &opcodes)
+{
+    return nanosecondsPerOperation(opcodes.size(), [&]() {
+        for (const EnumType opcode : opcodes)
+        {
+            ++counters[opcode];
+        }
+        return static_cast<size_t>(counters[opcodes.front()]);
+    });
+}
+
+int main(int, char *[])
+{
+    const size_t operations = 1 << 16;
+    std::mt19937 random(42);
+    std::vector<Opcode> opcodes(operations);
+    std::vector<DenseOpcode> denseOpcodes(operations);
+    for (size_t operation = 0; operation < operations; ++operation)
+    {
+        const size_t ordinal = random() % OpcodeMagicEnum.size();
+        opcodes[operation] = OpcodeMagicEnum.at(ordinal).getValue();
+        denseOpcodes[operation] = DenseOpcodeMagicEnum.at(ordinal).getValue();
+    }
+
+    std::map<Opcode, size_t> ordered;
+    std::unordered_map<Opcode, size_t> hashed;
+    auto dense = EnumHelper::makeEnumMap<size_t>(DenseOpcodeMagicEnum);
+    const double orderedCount = countAll(ordered, opcodes);
+    const double hashedCount = countAll(hashed, opcodes);
+    const double denseCount = countAll(dense, denseOpcodes);
+
+    printf("count  std::map %8.2f ns  std::unordered_map %8.2f ns  EnumMap %8.2f ns\n", orderedCount, hashedCount, denseCount);
+}
@@ -0,0 +1,107 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#include "EnumHelper.h"
+#include "Benchmark.h"
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace EnumHelper::enumflags;
+
+EnumHelper(Permission, Read = 1, Write = 2, Execute = 4, Delete = 8, Append = 16, Create = 32, List = 64, Traverse = 128,
+           ReadAttributes = 256, WriteAttributes = 512, ReadOwner = 1024, WriteOwner = 2048, Synchronize = 4096);
+
+/* What callers do without parseFlags: split into strings, then one lookup per name */
+static EnumFlags<Permission> naiveParse(const std::string &text)
+{
+    EnumFlags<Permission> flags;
+    std::vector<std::string> names;
+    size_t start = 0;
+    for (size_t position = 0; position <= text.size(); ++position)
+    {
+        if (position == text.size() || text[position] == '|')
+        {
+            names.push_back(text.substr(start, position - start));
+            start = position + 1;
+        }
+    }
+    for (const std::string &name : names)
+    {
+        flags |= PermissionMagicEnum(name.c_str()).getValue();
+    }
+    return flags;
+}
+
+/* And the matching formatter, one string append per flag */
+static std::string naiveFormat(EnumFlags<Permission> flags)
+{
+    std::string text;
+    for (const auto &entry : PermissionMagicEnum)
+    {
+        if (flags.test(entry.getValue()))
+        {
+            text += text.empty() ? "" : "|";
+            text += entry.toString();
+        }
+    }
+    return text;
+}
+
+int main(int, char *[])
+{
+    const size_t operations = 1 << 14;
+    const EnumFlags<Permission> all = allFlags(PermissionMagicEnum);
+    std::mt19937 random(42);
+    std::vector<EnumFlags<Permission>> sets(operations);
+    std::vector<std::string> texts(operations);
+    char buffer[256];
+    for (size_t operation = 0; operation < operations; ++operation)
+    {
+        sets[operation] = static_cast<Permission>(random() & all.flags);
+        sets[operation].toString(PermissionMagicEnum, buffer, sizeof(buffer));
+        texts[operation] = buffer;
+    }
+
+    const double naiveParsing = nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += naiveParse(texts[operation]).flags;
+        }
+        return sum;
+    });
+    const double singlePassParsing = nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        EnumFlags<Permission> flags;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            parseFlags(PermissionMagicEnum, texts[operation].data(), texts[operation].size(), flags);
+            sum += flags.flags;
+        }
+        return sum;
+    });
+    const double naiveFormatting = nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += naiveFormat(sets[operation]).size();
+        }
+        return sum;
+    });
+    const double bufferFormatting = nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += sets[operation].toString(PermissionMagicEnum, buffer, sizeof(buffer));
+        }
+        return sum;
+    });
+
+    printf("parse   split and lookup %8.2f ns  parseFlags %8.2f ns\n", naiveParsing, singlePassParsing);
+    printf("format  string appends   %8.2f ns  toString   %8.2f ns\n", naiveFormatting, bufferFormatting);
+}
@@ -0,0 +1,148 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#include "EnumHelperWithoutMacroMagic.h"
+#include "Benchmark.h"
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace bitset;
+
+/* The same enumerator lists as Runtime.cpp, the digits double as sparse values: S123 = 1231 */
+#define TEN(p) p##0, p##1, p##2, p##3, p##4, p##5, p##6, p##7, p##8, p##9
+#define HUNDRED(p) TEN(p##0), TEN(p##1), TEN(p##2), TEN(p##3), TEN(p##4), TEN(p##5), TEN(p##6), TEN(p##7), TEN(p##8), TEN(p##9)
+#define THOUSAND(p) HUNDRED(p##0), HUNDRED(p##1), HUNDRED(p##2), HUNDRED(p##3), HUNDRED(p##4), HUNDRED(p##5), HUNDRED(p##6), HUNDRED(p##7), HUNDRED(p##8), HUNDRED(p##9)
+#define SPARSE_TEN(p) S##p##0 = p##01, S##p##1 = p##11, S##p##2 = p##21, S##p##3 = p##31, S##p##4 = p##41, S##p##5 = p##51, S##p##6 = p##61, S##p##7 = p##71, S##p##8 = p##81, S##p##9 = p##91
+#define SPARSE_HUNDRED(p) SPARSE_TEN(p##0), SPARSE_TEN(p##1), SPARSE_TEN(p##2), SPARSE_TEN(p##3), SPARSE_TEN(p##4), SPARSE_TEN(p##5), SPARSE_TEN(p##6), SPARSE_TEN(p##7), SPARSE_TEN(p##8), SPARSE_TEN(p##9)
+#define SPARSE_THOUSAND(p) SPARSE_HUNDRED(p##0), SPARSE_HUNDRED(p##1), SPARSE_HUNDRED(p##2), SPARSE_HUNDRED(p##3), SPARSE_HUNDRED(p##4), SPARSE_HUNDRED(p##5), SPARSE_HUNDRED(p##6), SPARSE_HUNDRED(p##7), SPARSE_HUNDRED(p##8), SPARSE_HUNDRED(p##9)
+
+EnumHelper(Dense4, Read, Write, Execute, Delete);
+EnumHelper(Dense10, TEN(D));
+EnumHelper(Dense100, HUNDRED(D));
+EnumHelper(Dense1000, THOUSAND(D));
+EnumHelper(Sparse4, Read = 3, Write = 170, Execute = 1021, Delete = 40000);
+EnumHelper(Sparse10, SPARSE_TEN(1));
+EnumHelper(Sparse100, SPARSE_HUNDRED(1));
+EnumHelper(Sparse1000, SPARSE_THOUSAND(1));
+EnumHelper(Permission, Read = 1, Write = 2, Execute = 4, Delete = 8);
+
+template <typename EnumType, typename Table>
+static void benchmark(const char *name, const Table &constantTable)
+{
+    /* Read through a volatile pointer so the constexpr table is not folded into the loops */
+    const Table *volatile tablePointer = &constantTable;
+    const Table &table = *tablePointer;
+    const size_t operations = 1 << 14;
+    const size_t size = table.end() - table.begin();
+    std::mt19937 random(42);
+    std::vector<EnumType> hits(operations);
+    std::vector<EnumType> misses(operations);
+    std::vector<std::string> hitNames(operations);
+    std::vector<std::string> missNames(operations);
+    for (size_t operation = 0; operation < operations; ++operation)
+    {
+        const auto &entry = table.at(random() % size);
+        hits[operation] = entry.getValue();
+        /* Past the end of a dense enum, and between the values of a sparse one, which all end in 1 */
+        misses[operation] = static_cast<EnumType>(entry.getIntValue() + 10 * size + 1);
+        hitNames[operation] = entry.toString();
+        /* Same length and first character, so the miss gets past any cheap rejection */
+        missNames[operation] = hitNames[operation];
+        missNames[operation].back() = '_';
+    }
+
+    report(name, "value hit", nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += table(hits[operation]).getIntValue();
+        }
+        return sum;
+    }));
+    report(name, "value miss", nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += table(misses[operation]).getIntValue();
+        }
+        return sum;
+    }));
+    report(name, "name hit", nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += table(hitNames[operation].c_str()).getIntValue();
+        }
+        return sum;
+    }));
+    report(name, "name miss", nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += table(missNames[operation].c_str()).getIntValue();
+        }
+        return sum;
+    }));
+    report(name, "toString", nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            sum += *table(hits[operation]).toString();
+        }
+        return sum;
+    }));
+    report(name, "iteration", nanosecondsPerOperation(size * 64, [&]() {
+        size_t sum = 0;
+        for (int pass = 0; pass < 64; ++pass)
+        {
+            for (auto const &entry : *tablePointer)
+            {
+                sum += entry.getIntValue();
+            }
+        }
+        return sum;
+    }));
+}
+
+static void benchmarkFlags()
+{
+    const size_t operations = 1 << 14;
+    const Permission flags[] = {Permission::Read, Permission::Write, Permission::Execute, Permission::Delete};
+    std::mt19937 random(42);
+    std::vector<Permission> hits(operations);
+    for (size_t operation = 0; operation < operations; ++operation)
+    {
+        hits[operation] = flags[random() % 4];
+    }
+
+    report("Permission", "flags | & ^", nanosecondsPerOperation(operations, [&]() {
+        size_t sum = 0;
+        EnumFlags<Permission> set;
+        for (size_t operation = 0; operation < operations; ++operation)
+        {
+            set |= hits[operation];
+            set &= hits[operation ^ 1] | Permission::Read | Permission::Write;
+            set ^= hits[operation ^ 2];
+            sum += static_cast<size_t>(set.flags);
+        }
+        return sum;
+    }));
+}
+
+int main(int, char *[])
+{
+    benchmark<Dense4>("Dense4", Dense4MagicEnum);
+    benchmark<Dense10>("Dense10", Dense10MagicEnum);
+    benchmark<Dense100>("Dense100", Dense100MagicEnum);
+    benchmark<Dense1000>("Dense1000", Dense1000MagicEnum);
+    benchmark<Sparse4>("Sparse4", Sparse4MagicEnum);
+    benchmark<Sparse10>("Sparse10", Sparse10MagicEnum);
+    benchmark<Sparse100>("Sparse100", Sparse100MagicEnum);
+    benchmark<Sparse1000>("Sparse1000", Sparse1000MagicEnum);
+    benchmarkFlags();
+}
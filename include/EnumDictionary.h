@@ -0,0 +1,250 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+
+#ifndef ENUM_HELPER_DICTIONARY_H
+#define ENUM_HELPER_DICTIONARY_H
+
+#include "EnumHelperCore.h"
+
+#if !defined(USE_RELAXED_CONSTEXPR)
+#error "EnumDictionary.h needs C++14"
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace EnumHelper
+{
+/***************
+ * EnumDictionary
+ **************/
+/*
+ * Read side of writeDictionary, for decoders that have the dictionary file but not the enums. The file is
+ * mapped and checked once when it is opened, after that every lookup reads it in place: a hash probe for
+ * the enum, a binary search for the value, no parsing and no allocation.
+ */
+class EnumDictionary
+{
+public:
+    /* One enum of the dictionary. Look it up once, then decode every value of it through it */
+    class Enum
+    {
+        const unsigned char *data = nullptr;
+        const unsigned char *record = nullptr;
+
+        std::uint32_t field(size_t at) const { return static_cast<std::uint32_t>(detail::loadLittleEndian<std::uint32_t>(record + at)); }
+
+    public:
+        Enum() = default;
+        Enum(const unsigned char *data, const unsigned char *record) : data(data), record(record) {}
+
+        explicit operator bool() const { return record != nullptr; }
+
+        const char *name() const { return reinterpret_cast<const char *>(data + field(detail::dictionary::RecordNameAt)); }
+        size_t nameLength() const { return field(detail::dictionary::RecordNameLengthAt); }
+        std::uint64_t hash() const { return detail::loadLittleEndian<std::uint64_t>(record + detail::dictionary::RecordHashAt); }
+        /* Entries, Invalid included */
+        size_t size() const { return field(detail::dictionary::RecordEntryCountAt); }
+
+        /* Name of the first enumerator with the value, nullptr when there is none */
+        const char *nameOf(long long value) const
+        {
+            namespace format = detail::dictionary;
+            const size_t count = size();
+            if (count == 0)
+            {
+                return nullptr;
+            }
+            /* Branch free lower bound, decoded values are too random for the branch predictor */
+            const unsigned char *entries = data + field(format::RecordEntriesAt);
+            const unsigned char *entry = entries;
+            for (size_t remaining = count; remaining > 1; remaining -= remaining / 2)
+            {
+                const unsigned char *middle = entry + (remaining / 2) * format::EntryBytes;
+                entry = (static_cast<long long>(detail::loadLittleEndian<std::uint64_t>(middle)) < value) ? middle : entry;
+            }
+            entry += (static_cast<long long>(detail::loadLittleEndian<std::uint64_t>(entry)) < value) ? format::EntryBytes : 0;
+            return (entry < entries + count * format::EntryBytes && static_cast<long long>(detail::loadLittleEndian<std::uint64_t>(entry)) == value)
+                       ? reinterpret_cast<const char *>(data + detail::loadLittleEndian<std::uint32_t>(entry + format::EntryNameAt))
+                       : nullptr;
+        }
+    };
+
+    EnumDictionary() = default;
+#ifdef USE_MMAP
+    explicit EnumDictionary(const char *path) { open(path); }
+#endif
+    ~EnumDictionary() { close(); }
+
+    EnumDictionary(const EnumDictionary &) = delete;
+    EnumDictionary &operator=(const EnumDictionary &) = delete;
+
+    /* Uses a dictionary already in memory, which must outlive the lookups. False when it is not a valid dictionary */
+    bool attach(const void *bytes, size_t length)
+    {
+        close();
+        if (!valid(static_cast<const unsigned char *>(bytes), length))
+        {
+            return false;
+        }
+        data = static_cast<const unsigned char *>(bytes);
+        size = length;
+        return true;
+    }
+
+#ifdef USE_MMAP
+    /* Maps the file read only. False when it cannot be mapped or is not a valid dictionary */
+    bool open(const char *path)
+    {
+        close();
+        const int file = ::open(path, O_RDONLY);
+        struct stat status = {};
+        if (file < 0 || fstat(file, &status) != 0 || status.st_size <= 0)
+        {
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+            return false;
+        }
+        void *mapping = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+        if (mapping == MAP_FAILED)
+        {
+            return false;
+        }
+        if (!attach(mapping, static_cast<size_t>(status.st_size)))
+        {
+            munmap(mapping, static_cast<size_t>(status.st_size));
+            return false;
+        }
+        mapped = true;
+        return true;
+    }
+#endif
+
+    void close()
+    {
+#ifdef USE_MMAP
+        if (mapped)
+        {
+            munmap(const_cast<unsigned char *>(data), size);
+        }
+#endif
+        data = nullptr;
+        size = 0;
+        mapped = false;
+    }
+
+    bool isOpen() const { return data != nullptr; }
+
+    /* Every enum in the dictionary, for listing them */
+    size_t enumCount() const { return isOpen() ? header(detail::dictionary::EnumCountAt) : 0; }
+    Enum enumAt(size_t index) const { return Enum(data, recordsAt() + index * detail::dictionary::RecordBytes); }
+
+    /* The enum named by the length characters at name, an empty Enum when the dictionary has none */
+    Enum find(const char *name, size_t length) const
+    {
+        namespace format = detail::dictionary;
+        if (!isOpen())
+        {
+            return Enum();
+        }
+        const std::uint64_t hash = detail::hashName(name, length);
+        const size_t slotCount = header(format::SlotCountAt);
+        for (size_t probe = 0; probe < slotCount; ++probe)
+        {
+            const size_t slot = detail::loadLittleEndian<std::uint32_t>(data + format::HeaderBytes + ((hash + probe) & (slotCount - 1)) * format::SlotBytes);
+            if (slot == 0)
+            {
+                break;
+            }
+            const Enum candidate = enumAt(slot - 1);
+            if (candidate.hash() == hash && candidate.nameLength() == length && std::memcmp(candidate.name(), name, length) == 0)
+            {
+                return candidate;
+            }
+        }
+        return Enum();
+    }
+
+    Enum find(const char *name) const { return find(name, std::strlen(name)); }
+
+#ifdef USE_STRING_VIEW
+    Enum find(std::string_view name) const { return find(name.data(), name.size()); }
+#endif
+
+    /* Name of the value in the named enum, nullptr when either is unknown */
+    const char *nameOf(const char *enumName, long long value) const
+    {
+        const Enum found = find(enumName);
+        return found ? found.nameOf(value) : nullptr;
+    }
+
+private:
+    const unsigned char *data = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+
+    size_t header(size_t at) const { return static_cast<size_t>(detail::loadLittleEndian<std::uint32_t>(data + at)); }
+    const unsigned char *recordsAt() const { return data + detail::dictionary::HeaderBytes + header(detail::dictionary::SlotCountAt) * detail::dictionary::SlotBytes; }
+
+    /* Every offset and length the lookups follow stays inside the file, so a damaged file cannot make them read past it */
+    static bool valid(const unsigned char *bytes, size_t length)
+    {
+        namespace format = detail::dictionary;
+        if (bytes == nullptr || length < format::HeaderBytes || std::memcmp(bytes, format::Magic, 8) != 0 ||
+            detail::loadLittleEndian<std::uint32_t>(bytes + format::VersionAt) != format::Version ||
+            detail::loadLittleEndian<std::uint64_t>(bytes + format::FileSizeAt) != length)
+        {
+            return false;
+        }
+        const std::uint64_t enumCount = detail::loadLittleEndian<std::uint32_t>(bytes + format::EnumCountAt);
+        const std::uint64_t slotCount = detail::loadLittleEndian<std::uint32_t>(bytes + format::SlotCountAt);
+        const std::uint64_t recordsAt = format::HeaderBytes + slotCount * format::SlotBytes;
+        if (slotCount == 0 || (slotCount & (slotCount - 1)) != 0 || slotCount < enumCount || recordsAt + enumCount * format::RecordBytes > length)
+        {
+            return false;
+        }
+        /* A name must fit with its terminator */
+        const auto validName = [bytes, length](std::uint64_t at, std::uint64_t nameLength) { return at + nameLength < length && bytes[at + nameLength] == '\0'; };
+        for (size_t slot = 0; slot < slotCount; ++slot)
+        {
+            if (detail::loadLittleEndian<std::uint32_t>(bytes + format::HeaderBytes + slot * format::SlotBytes) > enumCount)
+            {
+                return false;
+            }
+        }
+        for (size_t record = 0; record < enumCount; ++record)
+        {
+            const unsigned char *recordBytes = bytes + recordsAt + record * format::RecordBytes;
+            const std::uint64_t entriesAt = detail::loadLittleEndian<std::uint32_t>(recordBytes + format::RecordEntriesAt);
+            const std::uint64_t entryCount = detail::loadLittleEndian<std::uint32_t>(recordBytes + format::RecordEntryCountAt);
+            if (!validName(detail::loadLittleEndian<std::uint32_t>(recordBytes + format::RecordNameAt), detail::loadLittleEndian<std::uint32_t>(recordBytes + format::RecordNameLengthAt)) ||
+                entriesAt + entryCount * format::EntryBytes > length)
+            {
+                return false;
+            }
+            for (size_t entry = 0; entry < entryCount; ++entry)
+            {
+                const unsigned char *entryBytes = bytes + entriesAt + entry * format::EntryBytes;
+                if (!validName(detail::loadLittleEndian<std::uint32_t>(entryBytes + format::EntryNameAt), detail::loadLittleEndian<std::uint32_t>(entryBytes + format::EntryNameLengthAt)))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+}
+#endif
@@ -5,196 +5,65 @@
 * Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
 */
 
-#include <cstddef>
-#include <type_traits>
-#include <iterator>
-#include <utility>
-#include <algorithm>
+#include "EnumHelperCore.h"
+#include <iosfwd>
 
-#if __cplusplus >= 201703L // C++ 17 code goes here
-#define USING_STD_SEQUENCE
-#define USE_STRING_VIEW
-#define USING_STD_ARRAY
-
-#ifdef USE_STRING_VIEW
-#include <string_view>
+/* Largest number of enumerators, Invalid included, that EnumHelper() accepts: 64, 256 or 1024.
+   Larger maps cost a little more preprocessing in every translation unit */
+#ifndef ENUM_HELPER_MAX_ENUMERATORS
+#define ENUM_HELPER_MAX_ENUMERATORS 256
 #endif
 
-#ifdef USING_STD_ARRAY
-#include <array>
+/* std::formatter specialisations for the entries, when the standard library has <format> */
+#if __cplusplus >= 202002L && defined(__has_include)
+#if __has_include(<format>)
+#include <format>
 #endif
-
 #endif
 
-namespace EnumHelper
-{
-namespace detail
-{
-#ifdef USE_STRING_VIEW
-    constexpr bool stringsEqual(char const *a, char const *b)
-    {
-        return std::string_view(a) == std::string_view(b);
-    }
-#else
-    inline constexpr bool stringsEqual(char const *a, char const *b)
-    {
-        return *a == *b && (*b == '\0' || *a == '\0' || stringsEqual(a + 1, b + 1));
-    }
+#ifdef __cpp_lib_format
+#define USE_STD_FORMAT
 #endif
 
-template<typename T>
-constexpr T max(T val)
-{
-    return val;
-}
-
-template<typename T, class...Args>
-constexpr T max(T val, Args...args)
-{
-    return (val > max(args...)) ? val : max(args...);
-}
-/***************
- * KeyNameRetriever
- **************/
-
-/***************
- * MakeSeq
- **************/
-#ifdef USING_STD_SEQUENCE
-    template <size_t... Size>
-    using Seq = std::index_sequence<Size...>;
-#else
-    template <size_t... Size>
-    struct Seq
-    {
-    };
+/* fmt::formatter specialisations as well, when fmt was included before this header */
+#if defined(FMT_VERSION) && __cplusplus >= 201402L
+#define USE_FMT_FORMAT
 #endif
-    template <size_t Prepend, typename T>
-    struct appender
-    {
-    };
-
-    template <size_t Prepend, size_t... Sizes>
-    struct appender<Prepend, Seq<Sizes...>>
-    {
-        using type = Seq<Prepend, Sizes...>;
-    };
 
-    template <size_t from, size_t to>
-    struct MakeSeqImpl
-    {
-        using type = typename appender<from, typename MakeSeqImpl<from + 1, to>::type>::type;
-    };
+/* ENUM_HELPER_REGISTRY registers every enum under its name, see EnumDescriptor. Off by default */
+#if defined(ENUM_HELPER_REGISTRY) && !defined(USE_RELAXED_CONSTEXPR)
+#error "ENUM_HELPER_REGISTRY needs C++14"
+#endif
 
-    template <size_t to>
-    struct MakeSeqImpl<to, to>
-    {
-        using type = Seq<>;
-    };
+/* Slots in the registry table, a power of two. Enums registered once it is full are still found, by a walk of every enum */
+#ifndef ENUM_HELPER_REGISTRY_SLOTS
+#define ENUM_HELPER_REGISTRY_SLOTS 1024
+#endif
 
-    template <size_t to>
-    struct MakeSeqToImpl
-    {
-        using type = typename MakeSeqImpl<0, to>::type;
-    };
+#ifdef ENUM_HELPER_REGISTRY
+#include <atomic>
+#endif
 
-/***************
- * ConstExprArray
- **************/
-#ifdef USING_STD_ARRAY
-    template <typename T, size_t dim>
-    using ConstExprArray = std::array<T, dim>;
-#else
-    template <typename T, size_t dim>
-    struct ConstExprArrayStruct
+namespace EnumHelper
+{
+namespace detail
+{
+#ifdef USE_RELAXED_CONSTEXPR
+    /* Characters needed to store every name NUL terminated */
+    constexpr size_t namePoolSize(const char *csv)
     {
-        const T arr[dim];
-        constexpr const T &operator[](size_t index) const
+        size_t size = 0;
+        for (size_t offset = 0;; offset = findComma(csv, offset) + 1)
         {
-            return arr[index];
+            const size_t name = trimStart(csv, offset);
+            size += findEnd(csv, name) - name + 1;
+            if (csv[findComma(csv, offset)] == '\0')
+            {
+                return size;
+            }
         }
-    };
-    template <typename T, size_t dim>
-    using ConstExprArray = ConstExprArrayStruct<T, dim>;
-#endif
-
-    template <typename T, size_t LL, size_t RL, size_t... LLs, size_t... RLs>
-    constexpr ConstExprArray<T, LL + RL> join(ConstExprArray<T, LL> lhs, ConstExprArray<T, RL> rhs, detail::Seq<LLs...>, detail::Seq<RLs...>)
-    {
-        return {rhs[LLs]..., lhs[RLs]...};
-    }
-
-    template <typename T, size_t LL, size_t RL>
-    constexpr ConstExprArray<T, LL + RL> join(ConstExprArray<T, LL> lhs, ConstExprArray<T, RL> rhs)
-    {
-        return join(rhs, lhs, typename detail::MakeSeqImpl<0, LL>::type(), typename detail::MakeSeqImpl<0, RL>::type());
-    }
-
-    template <size_t dim>
-    constexpr ConstExprArray<const char, dim> createString(const char *csv, const size_t maxLength, const size_t index = 0)
-    {
-        return join(createString<dim / 2>(csv, maxLength, index), createString<dim - dim / 2>(csv, maxLength, index + dim / 2));
-    }
-
-    template <>
-    constexpr ConstExprArray<const char, 1> createString<1>(const char *csv, const size_t maxLength, const size_t index)
-    {
-        return {(index >= maxLength) ? '\0' : csv[index]};
-    }
-
-    /***************
-    * CSV, Used for finding max key length
-    **************/
-    constexpr std::size_t findComma(const char *str, std::size_t startOffset = 0)
-    {
-        return (str[startOffset] == ',') ? startOffset : (str[startOffset] == '\0') ? startOffset
-                                                                                    : findComma(str + 1, startOffset) + 1;
-    }
-
-    constexpr size_t findEnd(const char *str, size_t startOffset = 0)
-    {
-        return (str[startOffset] == ',' || str[startOffset] == '\0') ? startOffset : (str[startOffset] == ' ' || str[startOffset] == '=') ? startOffset
-                                                                                                                                          : findEnd(str + 1, startOffset) + 1;
-    }
-
-    constexpr size_t trimStart(const char *str, size_t pos)
-    {
-        return (str[pos] != ' ') ? pos : trimStart(str, pos + 1);
-    }
-
-    constexpr std::size_t findIndex(int index, const char *str, std::size_t pos = 0)
-    {
-        return (index == 0) ? pos : findIndex(index - 1, str + findComma(str) + 1, findComma(str) + pos + 1);
-    }
-
-    constexpr size_t findLastIndex(const char *str, size_t startIndex = 0)
-    {
-        return (str[findComma(str, findIndex(startIndex, str))] == '\0') ? startIndex : findLastIndex(str, startIndex + 1);
-    }
-
-    constexpr size_t findKeyLength(const char *str)
-    {
-        return findEnd(str, 0) - trimStart(str, 0);
-    }
-
-    constexpr size_t findKeyLength(size_t index, const char *str)
-    {
-        return findEnd(str, findIndex(index, str) + 1) - trimStart(str, findIndex(index, str));
-    }
-    constexpr size_t max(size_t a, size_t b)
-    {
-        return (a > b) ? a : b;
-    }
-
-    constexpr size_t findMaxLength(const char *str, size_t index)
-    {
-        return (index == 0) ? findEnd(str) : max(findKeyLength(index, str), findMaxLength(str, index - 1));
-    }
-
-    constexpr size_t findMaxLength(const char *str)
-    {
-        return findMaxLength(str, findLastIndex(str));
     }
+#endif
 
     /***************
     * ValueRetreiver
@@ -223,11 +92,17 @@ class EnumPair
 {
 public:
     const char name[N];
+    /* Computed with the table, so no caller has to strlen the name */
+    std::uint32_t length;
     EnumType value;
     constexpr const char *toString() const
     {
         return name;
     }
+    constexpr NameView getName() const
+    {
+        return NameView{name, length};
+    }
     constexpr size_t getIntValue() const
     {
         return static_cast<size_t>(value);
@@ -245,177 +120,545 @@ public:
 };
 
 template <typename EnumType, size_t N, size_t... Idx>
-constexpr EnumPair<EnumType, N> toEnumPair(const detail::ConstExprArray<const char, N> &arr, const EnumType &value, detail::Seq<Idx...>)
+constexpr EnumPair<EnumType, N> toEnumPair(const detail::ConstExprArray<const char, N> &arr, size_t length, const EnumType &value, detail::Seq<Idx...>)
 {
-    return {arr[Idx]..., value};
+    return {{arr[Idx]...}, static_cast<std::uint32_t>(length), value};
 }
 
 template <typename EnumType, size_t N>
-constexpr EnumPair<EnumType, N> toEnumPair(const detail::ConstExprArray<const char, N> &arr, const EnumType &value)
+constexpr EnumPair<EnumType, N> toEnumPair(const detail::ConstExprArray<const char, N> &arr, size_t length, const EnumType &value)
 {
-    return toEnumPair(arr, value, typename detail::MakeSeqToImpl<N>::type());
+    return toEnumPair(arr, length, value, typename detail::MakeSeqToImpl<N>::type());
 }
 
 template <typename EnumType, size_t N>
 constexpr EnumPair<EnumType, N> toEnumPair(const char *arr, size_t maxLen, const EnumType &value)
 {
-    return toEnumPair(detail::createString<N>(arr, maxLen), value);
+    return toEnumPair(detail::createString<N>(arr, maxLen), maxLen, value);
 }
 
-template <typename LookupTable, typename EnumPairType>
-class MagicEnum
+#ifdef USE_RELAXED_CONSTEXPR
+/***************
+ * Pooled layout
+ **************/
+/* Entry pointing into a shared name pool, so its size does not depend on the longest name */
+template <typename EnumType>
+class PooledEnumPair
 {
-    const LookupTable &lookupTable;
-
 public:
-    constexpr MagicEnum(const LookupTable &lookupTable) : lookupTable(lookupTable) {}
-
-    template <typename EnumType>
-    constexpr size_t indexOf(const EnumType &value, size_t index = 0) const
+    const char *name;
+    std::uint32_t length;
+    EnumType value;
+    constexpr const char *toString() const
     {
-        return (index >= sizeof(lookupTable) / sizeof(lookupTable[0])) ? (size_t)-1 : (value == lookupTable[index].value) ? index
-                                                                                                                          : indexOf<EnumType>(value, index + 1);
+        return name;
     }
-
-    constexpr size_t indexOf(const char *name, size_t index = 0) const
+    constexpr NameView getName() const
     {
-        return (index >= sizeof(lookupTable) / sizeof(lookupTable[0])) ? (size_t)(-1) : (detail::stringsEqual(name, lookupTable[index].name)) ? index
-                                                                                                                                              : indexOf(name, index + 1);
+        return NameView{name, length};
     }
-
-    template <typename EnumType>
-    constexpr const EnumPairType &operator()(const EnumType value) const
+    constexpr size_t getIntValue() const
     {
-        return (indexOf(value) == (size_t)(-1)) ? lookupTable[indexOf(EnumType::Invalid)] : lookupTable[indexOf(value)];
+        return static_cast<size_t>(value);
     }
 
-    constexpr const EnumPairType &operator()(const size_t value) const
+    constexpr const EnumType getValue() const
     {
-        return (indexOf(static_cast<decltype(EnumPairType::value)>(value)) == (size_t)(-1)) ? lookupTable[indexOf("Invalid")] : lookupTable[indexOf(static_cast<decltype(EnumPairType::value)>(value))];
+        return static_cast<EnumType>(value);
     }
 
-    constexpr const EnumPairType &operator()(const char *name) const
-    {
-        return (indexOf(name) == (size_t)(-1)) ? lookupTable[indexOf("Invalid")] : lookupTable[indexOf(name)];
-    }
+    constexpr operator size_t() const { return getIntValue();}
+    constexpr operator int() const { return getIntValue();}
+    constexpr operator const char*()  const { return toString();}
+    constexpr operator EnumType()  const { return getValue();}
+};
 
-    constexpr const EnumPairType &at(const size_t index) const
+/* All names back to back in one NUL separated pool, followed by the entries pointing into it */
+template <typename EnumType, size_t N, size_t PoolSize>
+struct PooledTable
+{
+    char pool[PoolSize];
+    PooledEnumPair<EnumType> entries[N];
+
+    constexpr PooledTable(const char *csv, const typename std::underlying_type<EnumType>::type (&values)[N]) : pool{}, entries{}
     {
-        return lookupTable[index];
+        size_t offset = 0;
+        for (size_t index = 0, start = 0; index < N; ++index, start = detail::findComma(csv, start) + 1)
+        {
+            const size_t name = detail::trimStart(csv, start);
+            const size_t length = detail::findEnd(csv, name) - name;
+            for (size_t character = 0; character < length; ++character)
+            {
+                pool[offset + character] = csv[name + character];
+            }
+            entries[index] = PooledEnumPair<EnumType>{pool + offset, static_cast<std::uint32_t>(length), static_cast<EnumType>(values[index])};
+            offset += length + 1;
+        }
     }
-
-    constexpr const EnumPairType *begin() const { return std::begin(lookupTable); }
-    /* Remove the last elemnt */
-    constexpr const EnumPairType *end() const { return std::end(lookupTable) - 1; }
 };
+#endif
 
 /***************
- * Enum flag handling
+ * Formatting
  **************/
-namespace enumflags
+/*
+ * to_chars style formatting into a caller buffer: each function writes into [first, last) and returns the end
+ * of what it wrote, or nullptr when it does not fit. Nothing is allocated and no NUL is written.
+ */
+namespace detail
 {
-    template <typename EnumClass>
-    class EnumFlags
+    inline char *integerToChars(char *first, char *last, unsigned long long magnitude, bool negative)
     {
-    public:
-        typename std::underlying_type<EnumClass>::type flags{};
-
-        EnumFlags(EnumClass flag) : flags(static_cast<typename std::underlying_type<EnumClass>::type>(flag))
+        char digits[24];
+        char *digit = digits + sizeof(digits);
+        do
+        {
+            *--digit = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (negative)
         {
+            *--digit = '-';
         }
-    };
-    template <typename EnumClass>
-    constexpr EnumFlags<EnumClass> operator|(EnumClass l, EnumClass r) noexcept
-    {
-        return EnumFlags<EnumClass>{l} | EnumFlags<EnumClass>{r};
+        const size_t length = static_cast<size_t>(digits + sizeof(digits) - digit);
+        if (first == nullptr || static_cast<size_t>(last - first) < length)
+        {
+            return nullptr;
+        }
+        std::memcpy(first, digit, length);
+        return first + length;
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator|(Enum l, EnumFlags<Enum> r) noexcept
+
+    inline char *integerToChars(char *first, char *last, long long value)
     {
-        return EnumFlags<Enum>{l} | r;
+        /* Negate in the unsigned type, which is also right for the minimum value */
+        return integerToChars(first, last, (value < 0) ? 0 - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value), value < 0);
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator|(EnumFlags<Enum> l, Enum r) noexcept
+
+    inline char *integerToChars(char *first, char *last, unsigned long long value)
     {
-        return l | EnumFlags<Enum>{r};
+        return integerToChars(first, last, value, false);
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator|(EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept
+
+    inline char *charsToChars(char *first, char *last, const char *chars, size_t length)
     {
-        return static_cast<Enum>(l.flags | r.flags);
+        if (first == nullptr || static_cast<size_t>(last - first) < length)
+        {
+            return nullptr;
+        }
+        std::memcpy(first, chars, length);
+        return first + length;
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> &operator|=(EnumFlags<Enum> &l, Enum r) noexcept
+}
+
+/* The name alone, as toString() returns it */
+template <typename Pair>
+char *nameToChars(char *first, char *last, const Pair &pair)
+{
+    return detail::charsToChars(first, last, pair.toString(), pair.length);
+}
+
+/* The value alone in decimal, signed when the underlying type is */
+template <typename Pair>
+char *valueToChars(char *first, char *last, const Pair &pair)
+{
+    using Underlying = typename std::underlying_type<typename std::decay<decltype(pair.value)>::type>::type;
+    /* Character types are printed as numbers, like every other underlying type */
+    using Printed = typename std::conditional<std::is_signed<Underlying>::value, long long, unsigned long long>::type;
+    return detail::integerToChars(first, last, static_cast<Printed>(pair.value));
+}
+
+/* Name(value), the same text operator<< writes */
+template <typename Pair>
+char *toChars(char *first, char *last, const Pair &pair)
+{
+    first = valueToChars(detail::charsToChars(nameToChars(first, last, pair), last, "(", 1), last, pair);
+    return detail::charsToChars(first, last, ")", 1);
+}
+
+#ifdef ENUM_HELPER_REGISTRY
+/***************
+ * Enum registry
+ **************/
+/*
+ * One enum seen through its name, for code that only learns at runtime which enum it is converting.
+ * The lookups go through function pointers into the enum's MagicEnum, so they cost what they cost there.
+ * Every instance inserts itself into a lock-free open addressing table keyed by the enum name, after
+ * that findEnum only loads. An enum declared at block scope registers when its declaration first runs,
+ * and the first enum registered under a name keeps it.
+ */
+class EnumDescriptor
+{
+    const char *enumName;
+    size_t nameLength;
+    std::uint64_t nameHash;
+    size_t enumeratorCount;
+    const void *magicEnum;
+    size_t (*indexOfFunction)(const void *, const char *, size_t);
+    size_t (*indexOfValueFunction)(const void *, long long);
+    NameView (*nameAtFunction)(const void *, size_t);
+    long long (*valueAtFunction)(const void *, size_t);
+    const EnumDescriptor *next = nullptr;
+
+    template <typename Magic>
+    using ValueOf = typename std::decay<decltype(std::declval<const Magic &>().at(0).value)>::type;
+
+    template <typename Magic>
+    static size_t erasedIndexOf(const void *magicEnum, const char *name, size_t length)
     {
-        return l = l | EnumFlags<Enum>{r};
+        return static_cast<const Magic *>(magicEnum)->indexOfSlice(name, length);
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> &operator|=(EnumFlags<Enum> &l, EnumFlags<Enum> r) noexcept
+
+    template <typename Magic>
+    static size_t erasedIndexOfValue(const void *magicEnum, long long value)
     {
-        return l = l | r;
+        using Underlying = typename std::underlying_type<ValueOf<Magic>>::type;
+        /* A value the underlying type cannot hold must not wrap onto an enumerator */
+        return (static_cast<long long>(static_cast<Underlying>(value)) != value)
+                   ? (size_t)(-1)
+                   : static_cast<const Magic *>(magicEnum)->indexOf(static_cast<ValueOf<Magic>>(static_cast<Underlying>(value)));
     }
 
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator&(Enum l, Enum r) noexcept
+    template <typename Magic>
+    static NameView erasedNameAt(const void *magicEnum, size_t index)
     {
-        return EnumFlags<Enum>{l} & EnumFlags<Enum>{r};
+        return static_cast<const Magic *>(magicEnum)->at(index).getName();
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator&(Enum l, EnumFlags<Enum> r) noexcept
+
+    template <typename Magic>
+    static long long erasedValueAt(const void *magicEnum, size_t index)
     {
-        return EnumFlags<Enum>{l} & r;
+        return static_cast<long long>(static_cast<const Magic *>(magicEnum)->at(index).value);
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator&(EnumFlags<Enum> l, Enum r) noexcept
+
+    static std::atomic<const EnumDescriptor *> (&slots())[ENUM_HELPER_REGISTRY_SLOTS]
     {
-        return l & EnumFlags<Enum>{r};
+        static std::atomic<const EnumDescriptor *> table[ENUM_HELPER_REGISTRY_SLOTS];
+        return table;
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator&(EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept
+
+    static std::atomic<const EnumDescriptor *> &registered()
     {
-        return static_cast<Enum>(l.flags & r.flags);
+        static std::atomic<const EnumDescriptor *> head{nullptr};
+        return head;
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> &operator&=(EnumFlags<Enum> &l, Enum r) noexcept
+
+    bool named(const char *name, size_t length) const
     {
-        return l = l & EnumFlags<Enum>{r};
+        return nameLength == length && std::memcmp(enumName, name, length) == 0;
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> &operator&=(EnumFlags<Enum> &l, EnumFlags<Enum> r) noexcept
+
+public:
+    template <typename Magic>
+    EnumDescriptor(const char *name, const Magic &magic)
+        : enumName(name), nameLength(std::strlen(name)), nameHash(detail::hashName(name, nameLength)), enumeratorCount(magic.end() - magic.begin()),
+          magicEnum(&magic), indexOfFunction(&erasedIndexOf<Magic>), indexOfValueFunction(&erasedIndexOfValue<Magic>), nameAtFunction(&erasedNameAt<Magic>),
+          valueAtFunction(&erasedValueAt<Magic>)
     {
-        return l = l & r;
+        const EnumDescriptor *first = registered().load(std::memory_order_relaxed);
+        do
+        {
+            next = first;
+        } while (!registered().compare_exchange_weak(first, this, std::memory_order_release, std::memory_order_relaxed));
+
+        for (size_t probe = 0; probe < ENUM_HELPER_REGISTRY_SLOTS; ++probe)
+        {
+            const EnumDescriptor *occupant = nullptr;
+            if (slots()[(nameHash + probe) & (ENUM_HELPER_REGISTRY_SLOTS - 1)].compare_exchange_strong(occupant, this, std::memory_order_release, std::memory_order_acquire) ||
+                occupant->named(enumName, nameLength))
+            {
+                return;
+            }
+        }
     }
 
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator^(Enum l, Enum r) noexcept
+    EnumDescriptor(const EnumDescriptor &) = delete;
+    EnumDescriptor &operator=(const EnumDescriptor &) = delete;
+
+    const char *name() const { return enumName; }
+    /* Enumerators without Invalid, which sits at index size() */
+    size_t size() const { return enumeratorCount; }
+    NameView nameAt(size_t index) const { return nameAtFunction(magicEnum, index); }
+    /* Unsigned 64 bit values come back as the long long with the same bits */
+    long long valueAt(size_t index) const { return valueAtFunction(magicEnum, index); }
+
+    /* Table index of the enumerator, (size_t)(-1) when there is none */
+    size_t indexOf(const char *name, size_t length) const { return indexOfFunction(magicEnum, name, length); }
+    size_t indexOf(const char *name) const { return indexOf(name, std::strlen(name)); }
+    size_t indexOfValue(long long value) const { return indexOfValueFunction(magicEnum, value); }
+
+    /* The enum registered under the length characters at name, nullptr when there is none */
+    static const EnumDescriptor *find(const char *name, size_t length)
     {
-        return EnumFlags<Enum>{l} ^ EnumFlags<Enum>{r};
+        const std::uint64_t hash = detail::hashName(name, length);
+        for (size_t probe = 0; probe < ENUM_HELPER_REGISTRY_SLOTS; ++probe)
+        {
+            const EnumDescriptor *occupant = slots()[(hash + probe) & (ENUM_HELPER_REGISTRY_SLOTS - 1)].load(std::memory_order_acquire);
+            if (occupant == nullptr)
+            {
+                return nullptr;
+            }
+            if (occupant->nameHash == hash && occupant->named(name, length))
+            {
+                return occupant;
+            }
+        }
+        /* The table is full, later enums are only on the list */
+        for (const EnumDescriptor *descriptor = registered().load(std::memory_order_acquire); descriptor != nullptr; descriptor = descriptor->next)
+        {
+            if (descriptor->named(name, length))
+            {
+                return descriptor;
+            }
+        }
+        return nullptr;
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator^(Enum l, EnumFlags<Enum> r) noexcept
+
+    template <typename Visitor>
+    friend void visitEnums(Visitor visitor);
+};
+
+inline const EnumDescriptor *findEnum(const char *name, size_t length)
+{
+    return EnumDescriptor::find(name, length);
+}
+
+inline const EnumDescriptor *findEnum(const char *name)
+{
+    return EnumDescriptor::find(name, std::strlen(name));
+}
+
+#ifdef USE_STRING_VIEW
+inline const EnumDescriptor *findEnum(std::string_view name)
+{
+    return EnumDescriptor::find(name.data(), name.size());
+}
+#endif
+
+/*
+ * "Type.Enumerator" split at the last '.': the enum registered as Type, nullptr when there is none.
+ * index is set to the table index of Enumerator in it, (size_t)(-1) when it has no such enumerator.
+ */
+inline const EnumDescriptor *resolveEnumerator(const char *text, size_t length, size_t &index)
+{
+    size_t dot = length;
+    for (; dot > 0 && text[dot - 1] != '.'; --dot)
     {
-        return EnumFlags<Enum>{l} ^ r;
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator^(EnumFlags<Enum> l, Enum r) noexcept
+    const EnumDescriptor *descriptor = (dot > 0) ? EnumDescriptor::find(text, dot - 1) : nullptr;
+    index = (descriptor != nullptr) ? descriptor->indexOf(text + dot, length - dot) : (size_t)(-1);
+    return descriptor;
+}
+
+/* Calls visitor(const EnumDescriptor &) for every registered enum, newest first */
+template <typename Visitor>
+void visitEnums(Visitor visitor)
+{
+    for (const EnumDescriptor *descriptor = EnumDescriptor::registered().load(std::memory_order_acquire); descriptor != nullptr; descriptor = descriptor->next)
     {
-        return l ^ EnumFlags<Enum>{r};
+        visitor(*descriptor);
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> operator^(EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept
+}
+
+/*
+ * Every registered enum as a dictionary file for EnumDictionary.h, so logs can carry raw values and be
+ * decoded elsewhere. Writes only when the dictionary fits in [first, last) and returns its size either way,
+ * so a call with an empty buffer sizes the real one. An enum registered twice under a name is written once.
+ */
+inline size_t writeDictionary(unsigned char *first, unsigned char *last)
+{
+    namespace format = detail::dictionary;
+    size_t enumCount = 0;
+    size_t entryCount = 0;
+    size_t nameBytes = 0;
+    visitEnums([&](const EnumDescriptor &descriptor) {
+        if (findEnum(descriptor.name()) == &descriptor)
+        {
+            ++enumCount;
+            entryCount += descriptor.size() + 1;
+            nameBytes += std::strlen(descriptor.name()) + 1;
+            for (size_t index = 0; index <= descriptor.size(); ++index)
+            {
+                nameBytes += descriptor.nameAt(index).size() + 1;
+            }
+        }
+    });
+    const size_t slotCount = detail::nextPowerOfTwo(2 * enumCount, 2);
+    const size_t recordsAt = format::HeaderBytes + slotCount * format::SlotBytes;
+    const size_t entriesAt = recordsAt + enumCount * format::RecordBytes;
+    const size_t namesAt = entriesAt + entryCount * format::EntryBytes;
+    const size_t size = namesAt + nameBytes;
+    if (static_cast<size_t>(last - first) < size)
     {
-        return static_cast<Enum>(l.flags ^ r.flags);
+        return size;
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> &operator^=(EnumFlags<Enum> &l, Enum r) noexcept
+
+    std::memset(first, 0, recordsAt);
+    std::memcpy(first, format::Magic, 8);
+    detail::storeLittleEndian<std::uint32_t>(first + format::VersionAt, format::Version);
+    detail::storeLittleEndian<std::uint32_t>(first + format::EnumCountAt, enumCount);
+    detail::storeLittleEndian<std::uint32_t>(first + format::SlotCountAt, slotCount);
+    detail::storeLittleEndian<std::uint64_t>(first + format::FileSizeAt, size);
+
+    size_t record = 0;
+    size_t entry = 0;
+    size_t name = namesAt;
+    const auto storeName = [first, &name](const char *text, size_t length) {
+        std::memcpy(first + name, text, length);
+        first[name + length] = '\0';
+        name += length + 1;
+    };
+    visitEnums([&](const EnumDescriptor &descriptor) {
+        if (findEnum(descriptor.name()) != &descriptor)
+        {
+            return;
+        }
+        const size_t length = std::strlen(descriptor.name());
+        const std::uint64_t hash = detail::hashName(descriptor.name(), length);
+        unsigned char *recordBytes = first + recordsAt + record * format::RecordBytes;
+        detail::storeLittleEndian<std::uint64_t>(recordBytes + format::RecordHashAt, hash);
+        detail::storeLittleEndian<std::uint32_t>(recordBytes + format::RecordNameAt, name);
+        detail::storeLittleEndian<std::uint32_t>(recordBytes + format::RecordNameLengthAt, length);
+        detail::storeLittleEndian<std::uint32_t>(recordBytes + format::RecordEntryCountAt, descriptor.size() + 1);
+        detail::storeLittleEndian<std::uint32_t>(recordBytes + format::RecordEntriesAt, entriesAt + entry * format::EntryBytes);
+        storeName(descriptor.name(), length);
+        for (size_t probe = 0;; ++probe)
+        {
+            unsigned char *slot = first + format::HeaderBytes + ((hash + probe) & (slotCount - 1)) * format::SlotBytes;
+            if (detail::loadLittleEndian<std::uint32_t>(slot) == 0)
+            {
+                detail::storeLittleEndian<std::uint32_t>(slot, record + 1);
+                break;
+            }
+        }
+
+        /* Insertion sort by value, equal values keep their table order like the lookups do */
+        unsigned char *entries = first + entriesAt + entry * format::EntryBytes;
+        for (size_t index = 0; index <= descriptor.size(); ++index)
+        {
+            const long long value = descriptor.valueAt(index);
+            size_t position = index;
+            for (; position > 0 && static_cast<long long>(detail::loadLittleEndian<std::uint64_t>(entries + (position - 1) * format::EntryBytes)) > value; --position)
+            {
+            }
+            std::memmove(entries + (position + 1) * format::EntryBytes, entries + position * format::EntryBytes, (index - position) * format::EntryBytes);
+            unsigned char *entryBytes = entries + position * format::EntryBytes;
+            const NameView entryName = descriptor.nameAt(index);
+            detail::storeLittleEndian<std::uint64_t>(entryBytes + format::EntryValueAt, static_cast<std::uint64_t>(value));
+            detail::storeLittleEndian<std::uint32_t>(entryBytes + format::EntryNameAt, name);
+            detail::storeLittleEndian<std::uint32_t>(entryBytes + format::EntryNameLengthAt, entryName.size());
+            storeName(entryName.data(), entryName.size());
+        }
+        entry += descriptor.size() + 1;
+        ++record;
+    });
+    return size;
+}
+#endif
+
+/***************
+ * EnumMap
+ **************/
+/*
+ * One Value per enumerator in a plain array indexed by ordinal, for per-enumerator counters, handlers or
+ * settings. The key is the enum's MagicEnum type, since a block scope enum has no way to its table from
+ * the enum type alone: auto counters = EnumHelper::makeEnumMap<int>(ColorMagicEnum). Enumerators that
+ * share a value share the slot of the first of them.
+ *
+ * A value finds its slot through the direct value index of the enum, one subtraction and one load. Only
+ * an enum with such an index is accepted: one declared with lookup::Dense, or one whose values are
+ * compact enough for lookup::Automatic to pick it. Requires C++14, like the index.
+ */
+template <typename Table, typename Value>
+class EnumMap
+{
+    using EnumPairType = typename std::remove_reference<decltype(std::declval<Table>().at(0))>::type;
+    using EnumValue = decltype(EnumPairType::value);
+    static constexpr size_t Size = Table::size();
+    static_assert(Table::hasDirectIndex(), "EnumMap: the enum needs a direct value index, declare it with EnumHelperLookup(Dense, ...)");
+
+    const Table *table;
+    /* ordinalOf maps a value without an enumerator to Size, where Invalid sits in the table. The spare
+       slot there takes those lookups, so operator[] never leaves the array. Iteration, size() and fill
+       leave it out */
+    Value values[Size + 1]{};
+
+    /* Iteration yields an Entry: the enumerator and a reference to its value, so that for (auto entry : map) can assign */
+    template <typename Reference>
+    struct Entry
+    {
+        const EnumPairType &key;
+        Reference value;
+    };
+
+    template <typename Reference, typename Pointer>
+    class Iterator
     {
-        return l = l ^ EnumFlags<Enum>{r};
+        const EnumPairType *key;
+        Pointer value;
+
+    public:
+        constexpr Iterator(const EnumPairType *key, Pointer value) : key(key), value(value) {}
+
+        constexpr Entry<Reference> operator*() const { return Entry<Reference>{*key, *value}; }
+
+        Iterator &operator++()
+        {
+            ++key;
+            ++value;
+            return *this;
+        }
+
+        constexpr bool operator==(const Iterator &other) const { return value == other.value; }
+        constexpr bool operator!=(const Iterator &other) const { return value != other.value; }
+    };
+
+public:
+    using iterator = Iterator<Value &, Value *>;
+    using const_iterator = Iterator<const Value &, const Value *>;
+
+    constexpr explicit EnumMap(const Table &table) : table(&table) {}
+
+    static constexpr size_t size() { return Size; }
+
+    /* A value without an enumerator, Invalid included, gets the spare slot. Use find to tell them apart */
+    Value &operator[](const EnumValue value) { return values[table->ordinalOf(value)]; }
+    constexpr const Value &operator[](const EnumValue value) const { return values[table->ordinalOf(value)]; }
+
+    /* nullptr when no enumerator has the value */
+    Value *find(const EnumValue value)
+    {
+        const size_t ordinal = table->ordinalOf(value);
+        return (ordinal < Size) ? &values[ordinal] : nullptr;
     }
-    template <typename Enum>
-    constexpr EnumFlags<Enum> &operator^=(EnumFlags<Enum> &l, EnumFlags<Enum> r) noexcept
+
+    constexpr const Value *find(const EnumValue value) const { return (table->ordinalOf(value) < Size) ? &values[table->ordinalOf(value)] : nullptr; }
+
+    /* Ordinal order is table order, the same as fromOrdinal and the wire encoding */
+    Value &atOrdinal(const size_t ordinal) { return values[ordinal]; }
+    constexpr const Value &atOrdinal(const size_t ordinal) const { return values[ordinal]; }
+
+    Value *data() { return values; }
+    constexpr const Value *data() const { return values; }
+
+    void fill(const Value &value)
     {
-        return l = l ^ r;
+        for (size_t ordinal = 0; ordinal < Size; ++ordinal)
+        {
+            values[ordinal] = value;
+        }
     }
+
+    iterator begin() { return iterator(table->begin(), values); }
+    iterator end() { return iterator(table->end(), values + Size); }
+    constexpr const_iterator begin() const { return const_iterator(table->begin(), values); }
+    constexpr const_iterator end() const { return const_iterator(table->end(), values + Size); }
+};
+
+template <typename Value, typename Table>
+EnumMap<Table, Value> makeEnumMap(const Table &table)
+{
+    return EnumMap<Table, Value>(table);
 }
 }
 
@@ -423,86 +666,1236 @@ namespace enumflags
  * MacroMagic
  **************/
 // Use g++ -E a.cpp to only check pre parser
-#define EMPTY()
-#define CAT(a, ...) PRIMITIVE_CAT(a, __VA_ARGS__)
-#define PRIMITIVE_CAT(a, ...) a##__VA_ARGS__
-
-#define COMPL(b) PRIMITIVE_CAT(COMPL_, b)
-#define COMPL_0 1
-#define COMPL_1 0
-
-#define CHECK_N(x, n, ...) n
-#define CHECK(...) CHECK_N(__VA_ARGS__, 0, )
-#define PROBE(x) x, 1,
-
-#define NOT(x) CHECK(PRIMITIVE_CAT(NOT_, x))
-#define NOT_0 PROBE(~)
-#define NOT_ PROBE(~)
-
-#define BOOL(x) COMPL(NOT(x))
-
-#define EVAL(...) EVAL1024(__VA_ARGS__)
-#define EVAL1024(...) EVAL256(EVAL256(EVAL256(EVAL256(__VA_ARGS__))))
-#define EVAL256(...) EVAL64(EVAL64(EVAL64(EVAL64(__VA_ARGS__))))
-#define EVAL64(...) EVAL16(EVAL16(EVAL16(EVAL16(__VA_ARGS__))))
-#define EVAL16(...) EVAL4(EVAL4(EVAL4(EVAL4(__VA_ARGS__))))
-#define EVAL4(...) EVAL1(EVAL1(EVAL1(EVAL1(__VA_ARGS__))))
-#define EVAL2(...) EVAL1(EVAL1(__VA_ARGS__))
-#define EVAL1(...) __VA_ARGS__
-
-#define DEFER2(m) m EMPTY EMPTY()()
-
-#define IF_ELSE(condition) _IF_ELSE(BOOL(condition))
-#define _IF_ELSE(condition) CAT(_IF_, condition)
-
-#define _IF_1(...) __VA_ARGS__ _IF_1_ELSE
-#define _IF_0(...) _IF_0_ELSE
-
-#define _IF_1_ELSE(...)
-#define _IF_0_ELSE(...) __VA_ARGS__
-
-#define FIRST(a, ...) a
-
-#define HAS_ARGS(...) BOOL(FIRST(_END_OF_ARGUMENTS_ __VA_ARGS__)())
-#define _END_OF_ARGUMENTS_() 0
-
-#define MAP(m, first, ...)                                                   \
-    m(first)                                                                 \
-        IF_ELSE(HAS_ARGS(__VA_ARGS__))(                                      \
-            DEFER2(_MAP)()(m, __VA_ARGS__))(/* Do nothing, just terminate */ \
-        )
-#define _MAP() MAP
-
-#define MAP2(m, data1, data2, first, ...)                                                   \
-    m(data1, data2, first)                                                                  \
-        IF_ELSE(HAS_ARGS(__VA_ARGS__))(                                                     \
-            DEFER2(_MAP2)()(m, data1, data2, __VA_ARGS__))(/* Do nothing, just terminate */ \
-        )
-#define _MAP2() MAP2
-
-#define ENUM_HELPER_(EnumType, ...)                                                                                                                                                        \
-    enum class EnumType                                                                                                                                                                    \
-    {                                                                                                                                                                                      \
-        __VA_ARGS__                                                                                                                                                                        \
-    };                                                                                                                                                                                     \
-    static constexpr size_t EnumType##MaxKeyLength = EnumHelper::detail::findMaxLength(#__VA_ARGS__) + 1;                                                                                  \
-    static constexpr const EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength> EnumType##Map[] = {EVAL(MAP2(ENUM_HELPER_PAIR_CREATOR, EnumType, EnumType##MaxKeyLength, __VA_ARGS__))}; \
-    static constexpr auto EnumType##MagicEnum = EnumHelper::MagicEnum<decltype(EnumType##Map), EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>>(EnumType##Map);                     \
-    struct EnumType##MagicValue : public EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>                                                                                            \
-    {                                                                                                                                                                                      \
-        constexpr EnumType##MagicValue(const EnumType &value) : EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>(EnumType##MagicEnum(value)) {}                                      \
-        constexpr EnumType##MagicValue(const char *name) : EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>(EnumType##MagicEnum(name)) {}                                            \
-        constexpr EnumType##MagicValue(const size_t value) : EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>(EnumType##MagicEnum(value)) {}                                         \
+#if ENUM_HELPER_MAX_ENUMERATORS != 64 && ENUM_HELPER_MAX_ENUMERATORS != 256 && ENUM_HELPER_MAX_ENUMERATORS != 1024
+#error "ENUM_HELPER_MAX_ENUMERATORS must be 64, 256 or 1024"
+#endif
+
+#define ENUM_HELPER_CAT(a, b) ENUM_HELPER_PRIMITIVE_CAT(a, b)
+#define ENUM_HELPER_PRIMITIVE_CAT(a, b) a##b
+
+/* Calls m(data1, data2, x) for every x, the count picks the map so the expansion is linear in the number of enumerators */
+#define ENUM_HELPER_MAP(m, data1, data2, ...) ENUM_HELPER_CAT(ENUM_HELPER_MAP_, ENUM_HELPER_COUNT(__VA_ARGS__))(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_ENUM_HELPER_TOO_MANY_ENUMERATORS(...) _Pragma("GCC error \"EnumHelper: more enumerators than ENUM_HELPER_MAX_ENUMERATORS, which can be 64, 256 or 1024\"")
+
+/* Counts up to the maximum, the next maximum argument counts come out as ENUM_HELPER_TOO_MANY_ENUMERATORS */
+#if ENUM_HELPER_MAX_ENUMERATORS == 64
+#define ENUM_HELPER_COUNT(...) ENUM_HELPER_COUNT_N(__VA_ARGS__, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, )
+#define ENUM_HELPER_COUNT_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79, _80, _81, _82, _83, _84, _85, _86, _87, _88, _89, _90, _91, _92, _93, _94, _95, _96, _97, _98, _99, _100, _101, _102, _103, _104, _105, _106, _107, _108, _109, _110, _111, _112, _113, _114, _115, _116, _117, _118, _119, _120, _121, _122, _123, _124, _125, _126, _127, _128, n, ...) n
+#elif ENUM_HELPER_MAX_ENUMERATORS == 256
+#define ENUM_HELPER_COUNT(...) ENUM_HELPER_COUNT_N(__VA_ARGS__, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, 256, 255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, 240, 239, 238, 237, 236, 235, 234, 233, 232, 231, 230, 229, 228, 227, 226, 225, 224, 223, 222, 221, 220, 219, 218, 217, 216, 215, 214, 213, 212, 211, 210, 209, 208, 207, 206, 205, 204, 203, 202, 201, 200, 199, 198, 197, 196, 195, 194, 193, 192, 191, 190, 189, 188, 187, 186, 185, 184, 183, 182, 181, 180, 179, 178, 177, 176, 175, 174, 173, 172, 171, 170, 169, 168, 167, 166, 165, 164, 163, 162, 161, 160, 159, 158, 157, 156, 155, 154, 153, 152, 151, 150, 149, 148, 147, 146, 145, 144, 143, 142, 141, 140, 139, 138, 137, 136, 135, 134, 133, 132, 131, 130, 129, 128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, )
+#define ENUM_HELPER_COUNT_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79, _80, _81, _82, _83, _84, _85, _86, _87, _88, _89, _90, _91, _92, _93, _94, _95, _96, _97, _98, _99, _100, _101, _102, _103, _104, _105, _106, _107, _108, _109, _110, _111, _112, _113, _114, _115, _116, _117, _118, _119, _120, _121, _122, _123, _124, _125, _126, _127, _128, _129, _130, _131, _132, _133, _134, _135, _136, _137, _138, _139, _140, _141, _142, _143, _144, _145, _146, _147, _148, _149, _150, _151, _152, _153, _154, _155, _156, _157, _158, _159, _160, _161, _162, _163, _164, _165, _166, _167, _168, _169, _170, _171, _172, _173, _174, _175, _176, _177, _178, _179, _180, _181, _182, _183, _184, _185, _186, _187, _188, _189, _190, _191, _192, _193, _194, _195, _196, _197, _198, _199, _200, _201, _202, _203, _204, _205, _206, _207, _208, _209, _210, _211, _212, _213, _214, _215, _216, _217, _218, _219, _220, _221, _222, _223, _224, _225, _226, _227, _228, _229, _230, _231, _232, _233, _234, _235, _236, _237, _238, _239, _240, _241, _242, _243, _244, _245, _246, _247, _248, _249, _250, _251, _252, _253, _254, _255, _256, _257, _258, _259, _260, _261, _262, _263, _264, _265, _266, _267, _268, _269, _270, _271, _272, _273, _274, _275, _276, _277, _278, _279, _280, _281, _282, _283, _284, _285, _286, _287, _288, _289, _290, _291, _292, _293, _294, _295, _296, _297, _298, _299, _300, _301, _302, _303, _304, _305, _306, _307, _308, _309, _310, _311, _312, _313, _314, _315, _316, _317, _318, _319, _320, _321, _322, _323, _324, _325, _326, _327, _328, _329, _330, _331, _332, _333, _334, _335, _336, _337, _338, _339, _340, _341, _342, _343, _344, _345, _346, _347, _348, _349, _350, _351, _352, _353, _354, _355, _356, _357, _358, _359, _360, _361, _362, _363, _364, _365, _366, _367, _368, _369, _370, _371, _372, _373, _374, _375, _376, _377, _378, _379, _380, _381, _382, _383, _384, _385, _386, _387, _388, _389, _390, _391, _392, _393, _394, _395, _396, _397, _398, _399, _400, _401, _402, _403, _404, _405, _406, _407, _408, _409, _410, _411, _412, _413, _414, _415, _416, _417, _418, _419, _420, _421, _422, _423, _424, _425, _426, _427, _428, _429, _430, _431, _432, _433, _434, _435, _436, _437, _438, _439, _440, _441, _442, _443, _444, _445, _446, _447, _448, _449, _450, _451, _452, _453, _454, _455, _456, _457, _458, _459, _460, _461, _462, _463, _464, _465, _466, _467, _468, _469, _470, _471, _472, _473, _474, _475, _476, _477, _478, _479, _480, _481, _482, _483, _484, _485, _486, _487, _488, _489, _490, _491, _492, _493, _494, _495, _496, _497, _498, _499, _500, _501, _502, _503, _504, _505, _506, _507, _508, _509, _510, _511, _512, n, ...) n
+#elif ENUM_HELPER_MAX_ENUMERATORS == 1024
+#define ENUM_HELPER_COUNT(...) ENUM_HELPER_COUNT_N(__VA_ARGS__, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, ENUM_HELPER_TOO_MANY_ENUMERATORS, 1024, 1023, 1022, 1021, 1020, 1019, 1018, 1017, 1016, 1015, 1014, 1013, 1012, 1011, 1010, 1009, 1008, 1007, 1006, 1005, 1004, 1003, 1002, 1001, 1000, 999, 998, 997, 996, 995, 994, 993, 992, 991, 990, 989, 988, 987, 986, 985, 984, 983, 982, 981, 980, 979, 978, 977, 976, 975, 974, 973, 972, 971, 970, 969, 968, 967, 966, 965, 964, 963, 962, 961, 960, 959, 958, 957, 956, 955, 954, 953, 952, 951, 950, 949, 948, 947, 946, 945, 944, 943, 942, 941, 940, 939, 938, 937, 936, 935, 934, 933, 932, 931, 930, 929, 928, 927, 926, 925, 924, 923, 922, 921, 920, 919, 918, 917, 916, 915, 914, 913, 912, 911, 910, 909, 908, 907, 906, 905, 904, 903, 902, 901, 900, 899, 898, 897, 896, 895, 894, 893, 892, 891, 890, 889, 888, 887, 886, 885, 884, 883, 882, 881, 880, 879, 878, 877, 876, 875, 874, 873, 872, 871, 870, 869, 868, 867, 866, 865, 864, 863, 862, 861, 860, 859, 858, 857, 856, 855, 854, 853, 852, 851, 850, 849, 848, 847, 846, 845, 844, 843, 842, 841, 840, 839, 838, 837, 836, 835, 834, 833, 832, 831, 830, 829, 828, 827, 826, 825, 824, 823, 822, 821, 820, 819, 818, 817, 816, 815, 814, 813, 812, 811, 810, 809, 808, 807, 806, 805, 804, 803, 802, 801, 800, 799, 798, 797, 796, 795, 794, 793, 792, 791, 790, 789, 788, 787, 786, 785, 784, 783, 782, 781, 780, 779, 778, 777, 776, 775, 774, 773, 772, 771, 770, 769, 768, 767, 766, 765, 764, 763, 762, 761, 760, 759, 758, 757, 756, 755, 754, 753, 752, 751, 750, 749, 748, 747, 746, 745, 744, 743, 742, 741, 740, 739, 738, 737, 736, 735, 734, 733, 732, 731, 730, 729, 728, 727, 726, 725, 724, 723, 722, 721, 720, 719, 718, 717, 716, 715, 714, 713, 712, 711, 710, 709, 708, 707, 706, 705, 704, 703, 702, 701, 700, 699, 698, 697, 696, 695, 694, 693, 692, 691, 690, 689, 688, 687, 686, 685, 684, 683, 682, 681, 680, 679, 678, 677, 676, 675, 674, 673, 672, 671, 670, 669, 668, 667, 666, 665, 664, 663, 662, 661, 660, 659, 658, 657, 656, 655, 654, 653, 652, 651, 650, 649, 648, 647, 646, 645, 644, 643, 642, 641, 640, 639, 638, 637, 636, 635, 634, 633, 632, 631, 630, 629, 628, 627, 626, 625, 624, 623, 622, 621, 620, 619, 618, 617, 616, 615, 614, 613, 612, 611, 610, 609, 608, 607, 606, 605, 604, 603, 602, 601, 600, 599, 598, 597, 596, 595, 594, 593, 592, 591, 590, 589, 588, 587, 586, 585, 584, 583, 582, 581, 580, 579, 578, 577, 576, 575, 574, 573, 572, 571, 570, 569, 568, 567, 566, 565, 564, 563, 562, 561, 560, 559, 558, 557, 556, 555, 554, 553, 552, 551, 550, 549, 548, 547, 546, 545, 544, 543, 542, 541, 540, 539, 538, 537, 536, 535, 534, 533, 532, 531, 530, 529, 528, 527, 526, 525, 524, 523, 522, 521, 520, 519, 518, 517, 516, 515, 514, 513, 512, 511, 510, 509, 508, 507, 506, 505, 504, 503, 502, 501, 500, 499, 498, 497, 496, 495, 494, 493, 492, 491, 490, 489, 488, 487, 486, 485, 484, 483, 482, 481, 480, 479, 478, 477, 476, 475, 474, 473, 472, 471, 470, 469, 468, 467, 466, 465, 464, 463, 462, 461, 460, 459, 458, 457, 456, 455, 454, 453, 452, 451, 450, 449, 448, 447, 446, 445, 444, 443, 442, 441, 440, 439, 438, 437, 436, 435, 434, 433, 432, 431, 430, 429, 428, 427, 426, 425, 424, 423, 422, 421, 420, 419, 418, 417, 416, 415, 414, 413, 412, 411, 410, 409, 408, 407, 406, 405, 404, 403, 402, 401, 400, 399, 398, 397, 396, 395, 394, 393, 392, 391, 390, 389, 388, 387, 386, 385, 384, 383, 382, 381, 380, 379, 378, 377, 376, 375, 374, 373, 372, 371, 370, 369, 368, 367, 366, 365, 364, 363, 362, 361, 360, 359, 358, 357, 356, 355, 354, 353, 352, 351, 350, 349, 348, 347, 346, 345, 344, 343, 342, 341, 340, 339, 338, 337, 336, 335, 334, 333, 332, 331, 330, 329, 328, 327, 326, 325, 324, 323, 322, 321, 320, 319, 318, 317, 316, 315, 314, 313, 312, 311, 310, 309, 308, 307, 306, 305, 304, 303, 302, 301, 300, 299, 298, 297, 296, 295, 294, 293, 292, 291, 290, 289, 288, 287, 286, 285, 284, 283, 282, 281, 280, 279, 278, 277, 276, 275, 274, 273, 272, 271, 270, 269, 268, 267, 266, 265, 264, 263, 262, 261, 260, 259, 258, 257, 256, 255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, 240, 239, 238, 237, 236, 235, 234, 233, 232, 231, 230, 229, 228, 227, 226, 225, 224, 223, 222, 221, 220, 219, 218, 217, 216, 215, 214, 213, 212, 211, 210, 209, 208, 207, 206, 205, 204, 203, 202, 201, 200, 199, 198, 197, 196, 195, 194, 193, 192, 191, 190, 189, 188, 187, 186, 185, 184, 183, 182, 181, 180, 179, 178, 177, 176, 175, 174, 173, 172, 171, 170, 169, 168, 167, 166, 165, 164, 163, 162, 161, 160, 159, 158, 157, 156, 155, 154, 153, 152, 151, 150, 149, 148, 147, 146, 145, 144, 143, 142, 141, 140, 139, 138, 137, 136, 135, 134, 133, 132, 131, 130, 129, 128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118, 117, 116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, 85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68, 67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50, 49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, )
+#define ENUM_HELPER_COUNT_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, _71, _72, _73, _74, _75, _76, _77, _78, _79, _80, _81, _82, _83, _84, _85, _86, _87, _88, _89, _90, _91, _92, _93, _94, _95, _96, _97, _98, _99, _100, _101, _102, _103, _104, _105, _106, _107, _108, _109, _110, _111, _112, _113, _114, _115, _116, _117, _118, _119, _120, _121, _122, _123, _124, _125, _126, _127, _128, _129, _130, _131, _132, _133, _134, _135, _136, _137, _138, _139, _140, _141, _142, _143, _144, _145, _146, _147, _148, _149, _150, _151, _152, _153, _154, _155, _156, _157, _158, _159, _160, _161, _162, _163, _164, _165, _166, _167, _168, _169, _170, _171, _172, _173, _174, _175, _176, _177, _178, _179, _180, _181, _182, _183, _184, _185, _186, _187, _188, _189, _190, _191, _192, _193, _194, _195, _196, _197, _198, _199, _200, _201, _202, _203, _204, _205, _206, _207, _208, _209, _210, _211, _212, _213, _214, _215, _216, _217, _218, _219, _220, _221, _222, _223, _224, _225, _226, _227, _228, _229, _230, _231, _232, _233, _234, _235, _236, _237, _238, _239, _240, _241, _242, _243, _244, _245, _246, _247, _248, _249, _250, _251, _252, _253, _254, _255, _256, _257, _258, _259, _260, _261, _262, _263, _264, _265, _266, _267, _268, _269, _270, _271, _272, _273, _274, _275, _276, _277, _278, _279, _280, _281, _282, _283, _284, _285, _286, _287, _288, _289, _290, _291, _292, _293, _294, _295, _296, _297, _298, _299, _300, _301, _302, _303, _304, _305, _306, _307, _308, _309, _310, _311, _312, _313, _314, _315, _316, _317, _318, _319, _320, _321, _322, _323, _324, _325, _326, _327, _328, _329, _330, _331, _332, _333, _334, _335, _336, _337, _338, _339, _340, _341, _342, _343, _344, _345, _346, _347, _348, _349, _350, _351, _352, _353, _354, _355, _356, _357, _358, _359, _360, _361, _362, _363, _364, _365, _366, _367, _368, _369, _370, _371, _372, _373, _374, _375, _376, _377, _378, _379, _380, _381, _382, _383, _384, _385, _386, _387, _388, _389, _390, _391, _392, _393, _394, _395, _396, _397, _398, _399, _400, _401, _402, _403, _404, _405, _406, _407, _408, _409, _410, _411, _412, _413, _414, _415, _416, _417, _418, _419, _420, _421, _422, _423, _424, _425, _426, _427, _428, _429, _430, _431, _432, _433, _434, _435, _436, _437, _438, _439, _440, _441, _442, _443, _444, _445, _446, _447, _448, _449, _450, _451, _452, _453, _454, _455, _456, _457, _458, _459, _460, _461, _462, _463, _464, _465, _466, _467, _468, _469, _470, _471, _472, _473, _474, _475, _476, _477, _478, _479, _480, _481, _482, _483, _484, _485, _486, _487, _488, _489, _490, _491, _492, _493, _494, _495, _496, _497, _498, _499, _500, _501, _502, _503, _504, _505, _506, _507, _508, _509, _510, _511, _512, _513, _514, _515, _516, _517, _518, _519, _520, _521, _522, _523, _524, _525, _526, _527, _528, _529, _530, _531, _532, _533, _534, _535, _536, _537, _538, _539, _540, _541, _542, _543, _544, _545, _546, _547, _548, _549, _550, _551, _552, _553, _554, _555, _556, _557, _558, _559, _560, _561, _562, _563, _564, _565, _566, _567, _568, _569, _570, _571, _572, _573, _574, _575, _576, _577, _578, _579, _580, _581, _582, _583, _584, _585, _586, _587, _588, _589, _590, _591, _592, _593, _594, _595, _596, _597, _598, _599, _600, _601, _602, _603, _604, _605, _606, _607, _608, _609, _610, _611, _612, _613, _614, _615, _616, _617, _618, _619, _620, _621, _622, _623, _624, _625, _626, _627, _628, _629, _630, _631, _632, _633, _634, _635, _636, _637, _638, _639, _640, _641, _642, _643, _644, _645, _646, _647, _648, _649, _650, _651, _652, _653, _654, _655, _656, _657, _658, _659, _660, _661, _662, _663, _664, _665, _666, _667, _668, _669, _670, _671, _672, _673, _674, _675, _676, _677, _678, _679, _680, _681, _682, _683, _684, _685, _686, _687, _688, _689, _690, _691, _692, _693, _694, _695, _696, _697, _698, _699, _700, _701, _702, _703, _704, _705, _706, _707, _708, _709, _710, _711, _712, _713, _714, _715, _716, _717, _718, _719, _720, _721, _722, _723, _724, _725, _726, _727, _728, _729, _730, _731, _732, _733, _734, _735, _736, _737, _738, _739, _740, _741, _742, _743, _744, _745, _746, _747, _748, _749, _750, _751, _752, _753, _754, _755, _756, _757, _758, _759, _760, _761, _762, _763, _764, _765, _766, _767, _768, _769, _770, _771, _772, _773, _774, _775, _776, _777, _778, _779, _780, _781, _782, _783, _784, _785, _786, _787, _788, _789, _790, _791, _792, _793, _794, _795, _796, _797, _798, _799, _800, _801, _802, _803, _804, _805, _806, _807, _808, _809, _810, _811, _812, _813, _814, _815, _816, _817, _818, _819, _820, _821, _822, _823, _824, _825, _826, _827, _828, _829, _830, _831, _832, _833, _834, _835, _836, _837, _838, _839, _840, _841, _842, _843, _844, _845, _846, _847, _848, _849, _850, _851, _852, _853, _854, _855, _856, _857, _858, _859, _860, _861, _862, _863, _864, _865, _866, _867, _868, _869, _870, _871, _872, _873, _874, _875, _876, _877, _878, _879, _880, _881, _882, _883, _884, _885, _886, _887, _888, _889, _890, _891, _892, _893, _894, _895, _896, _897, _898, _899, _900, _901, _902, _903, _904, _905, _906, _907, _908, _909, _910, _911, _912, _913, _914, _915, _916, _917, _918, _919, _920, _921, _922, _923, _924, _925, _926, _927, _928, _929, _930, _931, _932, _933, _934, _935, _936, _937, _938, _939, _940, _941, _942, _943, _944, _945, _946, _947, _948, _949, _950, _951, _952, _953, _954, _955, _956, _957, _958, _959, _960, _961, _962, _963, _964, _965, _966, _967, _968, _969, _970, _971, _972, _973, _974, _975, _976, _977, _978, _979, _980, _981, _982, _983, _984, _985, _986, _987, _988, _989, _990, _991, _992, _993, _994, _995, _996, _997, _998, _999, _1000, _1001, _1002, _1003, _1004, _1005, _1006, _1007, _1008, _1009, _1010, _1011, _1012, _1013, _1014, _1015, _1016, _1017, _1018, _1019, _1020, _1021, _1022, _1023, _1024, _1025, _1026, _1027, _1028, _1029, _1030, _1031, _1032, _1033, _1034, _1035, _1036, _1037, _1038, _1039, _1040, _1041, _1042, _1043, _1044, _1045, _1046, _1047, _1048, _1049, _1050, _1051, _1052, _1053, _1054, _1055, _1056, _1057, _1058, _1059, _1060, _1061, _1062, _1063, _1064, _1065, _1066, _1067, _1068, _1069, _1070, _1071, _1072, _1073, _1074, _1075, _1076, _1077, _1078, _1079, _1080, _1081, _1082, _1083, _1084, _1085, _1086, _1087, _1088, _1089, _1090, _1091, _1092, _1093, _1094, _1095, _1096, _1097, _1098, _1099, _1100, _1101, _1102, _1103, _1104, _1105, _1106, _1107, _1108, _1109, _1110, _1111, _1112, _1113, _1114, _1115, _1116, _1117, _1118, _1119, _1120, _1121, _1122, _1123, _1124, _1125, _1126, _1127, _1128, _1129, _1130, _1131, _1132, _1133, _1134, _1135, _1136, _1137, _1138, _1139, _1140, _1141, _1142, _1143, _1144, _1145, _1146, _1147, _1148, _1149, _1150, _1151, _1152, _1153, _1154, _1155, _1156, _1157, _1158, _1159, _1160, _1161, _1162, _1163, _1164, _1165, _1166, _1167, _1168, _1169, _1170, _1171, _1172, _1173, _1174, _1175, _1176, _1177, _1178, _1179, _1180, _1181, _1182, _1183, _1184, _1185, _1186, _1187, _1188, _1189, _1190, _1191, _1192, _1193, _1194, _1195, _1196, _1197, _1198, _1199, _1200, _1201, _1202, _1203, _1204, _1205, _1206, _1207, _1208, _1209, _1210, _1211, _1212, _1213, _1214, _1215, _1216, _1217, _1218, _1219, _1220, _1221, _1222, _1223, _1224, _1225, _1226, _1227, _1228, _1229, _1230, _1231, _1232, _1233, _1234, _1235, _1236, _1237, _1238, _1239, _1240, _1241, _1242, _1243, _1244, _1245, _1246, _1247, _1248, _1249, _1250, _1251, _1252, _1253, _1254, _1255, _1256, _1257, _1258, _1259, _1260, _1261, _1262, _1263, _1264, _1265, _1266, _1267, _1268, _1269, _1270, _1271, _1272, _1273, _1274, _1275, _1276, _1277, _1278, _1279, _1280, _1281, _1282, _1283, _1284, _1285, _1286, _1287, _1288, _1289, _1290, _1291, _1292, _1293, _1294, _1295, _1296, _1297, _1298, _1299, _1300, _1301, _1302, _1303, _1304, _1305, _1306, _1307, _1308, _1309, _1310, _1311, _1312, _1313, _1314, _1315, _1316, _1317, _1318, _1319, _1320, _1321, _1322, _1323, _1324, _1325, _1326, _1327, _1328, _1329, _1330, _1331, _1332, _1333, _1334, _1335, _1336, _1337, _1338, _1339, _1340, _1341, _1342, _1343, _1344, _1345, _1346, _1347, _1348, _1349, _1350, _1351, _1352, _1353, _1354, _1355, _1356, _1357, _1358, _1359, _1360, _1361, _1362, _1363, _1364, _1365, _1366, _1367, _1368, _1369, _1370, _1371, _1372, _1373, _1374, _1375, _1376, _1377, _1378, _1379, _1380, _1381, _1382, _1383, _1384, _1385, _1386, _1387, _1388, _1389, _1390, _1391, _1392, _1393, _1394, _1395, _1396, _1397, _1398, _1399, _1400, _1401, _1402, _1403, _1404, _1405, _1406, _1407, _1408, _1409, _1410, _1411, _1412, _1413, _1414, _1415, _1416, _1417, _1418, _1419, _1420, _1421, _1422, _1423, _1424, _1425, _1426, _1427, _1428, _1429, _1430, _1431, _1432, _1433, _1434, _1435, _1436, _1437, _1438, _1439, _1440, _1441, _1442, _1443, _1444, _1445, _1446, _1447, _1448, _1449, _1450, _1451, _1452, _1453, _1454, _1455, _1456, _1457, _1458, _1459, _1460, _1461, _1462, _1463, _1464, _1465, _1466, _1467, _1468, _1469, _1470, _1471, _1472, _1473, _1474, _1475, _1476, _1477, _1478, _1479, _1480, _1481, _1482, _1483, _1484, _1485, _1486, _1487, _1488, _1489, _1490, _1491, _1492, _1493, _1494, _1495, _1496, _1497, _1498, _1499, _1500, _1501, _1502, _1503, _1504, _1505, _1506, _1507, _1508, _1509, _1510, _1511, _1512, _1513, _1514, _1515, _1516, _1517, _1518, _1519, _1520, _1521, _1522, _1523, _1524, _1525, _1526, _1527, _1528, _1529, _1530, _1531, _1532, _1533, _1534, _1535, _1536, _1537, _1538, _1539, _1540, _1541, _1542, _1543, _1544, _1545, _1546, _1547, _1548, _1549, _1550, _1551, _1552, _1553, _1554, _1555, _1556, _1557, _1558, _1559, _1560, _1561, _1562, _1563, _1564, _1565, _1566, _1567, _1568, _1569, _1570, _1571, _1572, _1573, _1574, _1575, _1576, _1577, _1578, _1579, _1580, _1581, _1582, _1583, _1584, _1585, _1586, _1587, _1588, _1589, _1590, _1591, _1592, _1593, _1594, _1595, _1596, _1597, _1598, _1599, _1600, _1601, _1602, _1603, _1604, _1605, _1606, _1607, _1608, _1609, _1610, _1611, _1612, _1613, _1614, _1615, _1616, _1617, _1618, _1619, _1620, _1621, _1622, _1623, _1624, _1625, _1626, _1627, _1628, _1629, _1630, _1631, _1632, _1633, _1634, _1635, _1636, _1637, _1638, _1639, _1640, _1641, _1642, _1643, _1644, _1645, _1646, _1647, _1648, _1649, _1650, _1651, _1652, _1653, _1654, _1655, _1656, _1657, _1658, _1659, _1660, _1661, _1662, _1663, _1664, _1665, _1666, _1667, _1668, _1669, _1670, _1671, _1672, _1673, _1674, _1675, _1676, _1677, _1678, _1679, _1680, _1681, _1682, _1683, _1684, _1685, _1686, _1687, _1688, _1689, _1690, _1691, _1692, _1693, _1694, _1695, _1696, _1697, _1698, _1699, _1700, _1701, _1702, _1703, _1704, _1705, _1706, _1707, _1708, _1709, _1710, _1711, _1712, _1713, _1714, _1715, _1716, _1717, _1718, _1719, _1720, _1721, _1722, _1723, _1724, _1725, _1726, _1727, _1728, _1729, _1730, _1731, _1732, _1733, _1734, _1735, _1736, _1737, _1738, _1739, _1740, _1741, _1742, _1743, _1744, _1745, _1746, _1747, _1748, _1749, _1750, _1751, _1752, _1753, _1754, _1755, _1756, _1757, _1758, _1759, _1760, _1761, _1762, _1763, _1764, _1765, _1766, _1767, _1768, _1769, _1770, _1771, _1772, _1773, _1774, _1775, _1776, _1777, _1778, _1779, _1780, _1781, _1782, _1783, _1784, _1785, _1786, _1787, _1788, _1789, _1790, _1791, _1792, _1793, _1794, _1795, _1796, _1797, _1798, _1799, _1800, _1801, _1802, _1803, _1804, _1805, _1806, _1807, _1808, _1809, _1810, _1811, _1812, _1813, _1814, _1815, _1816, _1817, _1818, _1819, _1820, _1821, _1822, _1823, _1824, _1825, _1826, _1827, _1828, _1829, _1830, _1831, _1832, _1833, _1834, _1835, _1836, _1837, _1838, _1839, _1840, _1841, _1842, _1843, _1844, _1845, _1846, _1847, _1848, _1849, _1850, _1851, _1852, _1853, _1854, _1855, _1856, _1857, _1858, _1859, _1860, _1861, _1862, _1863, _1864, _1865, _1866, _1867, _1868, _1869, _1870, _1871, _1872, _1873, _1874, _1875, _1876, _1877, _1878, _1879, _1880, _1881, _1882, _1883, _1884, _1885, _1886, _1887, _1888, _1889, _1890, _1891, _1892, _1893, _1894, _1895, _1896, _1897, _1898, _1899, _1900, _1901, _1902, _1903, _1904, _1905, _1906, _1907, _1908, _1909, _1910, _1911, _1912, _1913, _1914, _1915, _1916, _1917, _1918, _1919, _1920, _1921, _1922, _1923, _1924, _1925, _1926, _1927, _1928, _1929, _1930, _1931, _1932, _1933, _1934, _1935, _1936, _1937, _1938, _1939, _1940, _1941, _1942, _1943, _1944, _1945, _1946, _1947, _1948, _1949, _1950, _1951, _1952, _1953, _1954, _1955, _1956, _1957, _1958, _1959, _1960, _1961, _1962, _1963, _1964, _1965, _1966, _1967, _1968, _1969, _1970, _1971, _1972, _1973, _1974, _1975, _1976, _1977, _1978, _1979, _1980, _1981, _1982, _1983, _1984, _1985, _1986, _1987, _1988, _1989, _1990, _1991, _1992, _1993, _1994, _1995, _1996, _1997, _1998, _1999, _2000, _2001, _2002, _2003, _2004, _2005, _2006, _2007, _2008, _2009, _2010, _2011, _2012, _2013, _2014, _2015, _2016, _2017, _2018, _2019, _2020, _2021, _2022, _2023, _2024, _2025, _2026, _2027, _2028, _2029, _2030, _2031, _2032, _2033, _2034, _2035, _2036, _2037, _2038, _2039, _2040, _2041, _2042, _2043, _2044, _2045, _2046, _2047, _2048, n, ...) n
+#endif
+
+#define ENUM_HELPER_MAP_1(m, data1, data2, x) m(data1, data2, x)
+#define ENUM_HELPER_MAP_2(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_3(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_2(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_4(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_3(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_5(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_4(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_6(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_5(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_7(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_6(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_8(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_7(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_9(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_8(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_10(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_9(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_11(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_10(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_12(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_11(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_13(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_12(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_14(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_13(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_15(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_14(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_16(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_15(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_17(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_16(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_18(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_17(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_19(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_18(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_20(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_19(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_21(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_20(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_22(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_21(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_23(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_22(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_24(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_23(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_25(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_24(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_26(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_25(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_27(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_26(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_28(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_27(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_29(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_28(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_30(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_29(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_31(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_30(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_32(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_31(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_33(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_32(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_34(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_33(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_35(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_34(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_36(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_35(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_37(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_36(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_38(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_37(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_39(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_38(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_40(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_39(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_41(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_40(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_42(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_41(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_43(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_42(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_44(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_43(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_45(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_44(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_46(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_45(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_47(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_46(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_48(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_47(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_49(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_48(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_50(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_49(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_51(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_50(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_52(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_51(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_53(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_52(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_54(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_53(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_55(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_54(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_56(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_55(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_57(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_56(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_58(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_57(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_59(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_58(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_60(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_59(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_61(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_60(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_62(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_61(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_63(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_62(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_64(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_63(m, data1, data2, __VA_ARGS__)
+#if ENUM_HELPER_MAX_ENUMERATORS > 64
+#define ENUM_HELPER_MAP_65(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_64(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_66(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_65(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_67(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_66(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_68(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_67(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_69(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_68(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_70(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_69(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_71(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_70(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_72(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_71(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_73(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_72(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_74(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_73(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_75(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_74(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_76(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_75(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_77(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_76(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_78(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_77(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_79(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_78(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_80(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_79(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_81(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_80(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_82(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_81(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_83(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_82(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_84(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_83(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_85(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_84(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_86(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_85(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_87(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_86(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_88(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_87(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_89(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_88(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_90(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_89(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_91(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_90(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_92(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_91(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_93(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_92(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_94(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_93(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_95(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_94(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_96(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_95(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_97(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_96(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_98(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_97(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_99(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_98(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_100(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_99(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_101(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_100(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_102(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_101(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_103(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_102(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_104(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_103(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_105(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_104(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_106(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_105(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_107(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_106(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_108(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_107(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_109(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_108(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_110(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_109(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_111(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_110(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_112(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_111(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_113(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_112(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_114(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_113(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_115(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_114(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_116(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_115(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_117(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_116(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_118(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_117(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_119(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_118(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_120(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_119(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_121(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_120(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_122(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_121(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_123(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_122(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_124(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_123(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_125(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_124(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_126(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_125(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_127(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_126(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_128(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_127(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_129(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_128(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_130(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_129(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_131(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_130(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_132(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_131(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_133(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_132(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_134(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_133(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_135(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_134(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_136(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_135(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_137(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_136(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_138(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_137(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_139(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_138(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_140(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_139(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_141(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_140(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_142(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_141(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_143(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_142(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_144(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_143(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_145(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_144(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_146(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_145(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_147(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_146(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_148(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_147(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_149(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_148(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_150(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_149(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_151(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_150(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_152(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_151(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_153(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_152(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_154(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_153(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_155(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_154(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_156(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_155(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_157(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_156(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_158(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_157(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_159(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_158(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_160(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_159(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_161(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_160(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_162(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_161(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_163(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_162(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_164(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_163(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_165(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_164(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_166(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_165(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_167(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_166(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_168(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_167(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_169(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_168(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_170(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_169(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_171(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_170(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_172(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_171(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_173(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_172(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_174(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_173(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_175(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_174(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_176(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_175(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_177(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_176(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_178(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_177(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_179(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_178(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_180(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_179(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_181(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_180(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_182(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_181(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_183(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_182(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_184(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_183(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_185(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_184(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_186(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_185(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_187(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_186(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_188(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_187(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_189(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_188(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_190(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_189(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_191(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_190(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_192(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_191(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_193(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_192(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_194(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_193(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_195(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_194(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_196(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_195(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_197(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_196(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_198(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_197(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_199(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_198(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_200(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_199(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_201(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_200(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_202(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_201(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_203(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_202(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_204(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_203(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_205(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_204(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_206(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_205(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_207(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_206(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_208(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_207(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_209(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_208(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_210(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_209(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_211(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_210(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_212(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_211(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_213(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_212(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_214(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_213(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_215(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_214(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_216(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_215(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_217(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_216(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_218(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_217(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_219(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_218(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_220(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_219(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_221(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_220(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_222(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_221(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_223(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_222(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_224(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_223(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_225(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_224(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_226(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_225(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_227(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_226(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_228(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_227(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_229(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_228(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_230(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_229(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_231(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_230(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_232(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_231(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_233(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_232(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_234(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_233(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_235(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_234(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_236(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_235(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_237(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_236(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_238(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_237(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_239(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_238(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_240(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_239(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_241(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_240(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_242(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_241(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_243(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_242(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_244(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_243(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_245(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_244(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_246(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_245(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_247(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_246(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_248(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_247(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_249(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_248(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_250(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_249(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_251(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_250(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_252(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_251(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_253(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_252(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_254(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_253(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_255(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_254(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_256(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_255(m, data1, data2, __VA_ARGS__)
+#endif
+#if ENUM_HELPER_MAX_ENUMERATORS > 256
+#define ENUM_HELPER_MAP_257(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_256(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_258(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_257(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_259(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_258(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_260(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_259(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_261(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_260(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_262(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_261(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_263(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_262(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_264(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_263(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_265(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_264(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_266(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_265(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_267(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_266(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_268(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_267(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_269(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_268(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_270(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_269(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_271(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_270(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_272(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_271(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_273(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_272(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_274(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_273(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_275(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_274(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_276(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_275(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_277(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_276(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_278(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_277(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_279(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_278(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_280(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_279(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_281(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_280(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_282(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_281(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_283(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_282(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_284(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_283(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_285(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_284(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_286(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_285(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_287(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_286(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_288(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_287(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_289(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_288(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_290(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_289(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_291(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_290(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_292(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_291(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_293(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_292(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_294(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_293(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_295(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_294(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_296(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_295(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_297(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_296(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_298(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_297(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_299(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_298(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_300(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_299(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_301(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_300(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_302(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_301(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_303(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_302(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_304(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_303(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_305(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_304(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_306(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_305(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_307(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_306(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_308(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_307(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_309(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_308(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_310(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_309(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_311(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_310(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_312(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_311(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_313(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_312(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_314(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_313(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_315(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_314(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_316(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_315(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_317(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_316(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_318(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_317(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_319(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_318(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_320(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_319(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_321(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_320(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_322(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_321(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_323(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_322(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_324(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_323(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_325(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_324(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_326(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_325(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_327(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_326(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_328(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_327(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_329(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_328(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_330(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_329(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_331(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_330(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_332(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_331(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_333(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_332(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_334(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_333(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_335(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_334(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_336(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_335(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_337(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_336(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_338(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_337(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_339(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_338(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_340(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_339(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_341(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_340(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_342(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_341(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_343(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_342(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_344(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_343(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_345(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_344(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_346(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_345(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_347(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_346(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_348(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_347(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_349(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_348(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_350(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_349(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_351(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_350(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_352(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_351(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_353(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_352(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_354(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_353(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_355(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_354(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_356(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_355(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_357(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_356(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_358(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_357(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_359(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_358(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_360(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_359(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_361(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_360(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_362(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_361(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_363(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_362(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_364(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_363(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_365(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_364(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_366(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_365(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_367(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_366(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_368(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_367(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_369(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_368(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_370(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_369(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_371(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_370(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_372(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_371(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_373(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_372(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_374(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_373(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_375(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_374(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_376(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_375(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_377(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_376(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_378(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_377(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_379(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_378(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_380(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_379(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_381(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_380(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_382(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_381(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_383(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_382(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_384(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_383(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_385(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_384(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_386(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_385(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_387(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_386(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_388(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_387(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_389(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_388(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_390(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_389(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_391(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_390(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_392(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_391(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_393(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_392(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_394(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_393(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_395(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_394(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_396(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_395(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_397(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_396(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_398(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_397(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_399(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_398(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_400(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_399(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_401(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_400(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_402(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_401(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_403(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_402(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_404(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_403(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_405(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_404(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_406(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_405(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_407(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_406(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_408(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_407(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_409(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_408(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_410(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_409(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_411(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_410(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_412(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_411(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_413(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_412(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_414(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_413(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_415(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_414(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_416(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_415(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_417(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_416(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_418(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_417(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_419(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_418(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_420(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_419(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_421(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_420(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_422(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_421(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_423(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_422(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_424(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_423(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_425(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_424(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_426(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_425(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_427(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_426(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_428(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_427(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_429(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_428(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_430(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_429(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_431(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_430(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_432(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_431(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_433(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_432(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_434(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_433(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_435(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_434(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_436(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_435(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_437(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_436(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_438(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_437(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_439(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_438(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_440(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_439(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_441(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_440(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_442(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_441(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_443(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_442(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_444(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_443(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_445(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_444(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_446(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_445(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_447(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_446(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_448(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_447(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_449(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_448(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_450(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_449(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_451(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_450(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_452(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_451(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_453(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_452(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_454(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_453(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_455(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_454(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_456(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_455(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_457(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_456(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_458(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_457(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_459(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_458(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_460(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_459(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_461(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_460(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_462(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_461(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_463(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_462(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_464(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_463(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_465(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_464(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_466(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_465(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_467(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_466(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_468(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_467(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_469(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_468(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_470(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_469(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_471(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_470(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_472(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_471(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_473(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_472(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_474(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_473(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_475(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_474(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_476(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_475(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_477(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_476(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_478(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_477(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_479(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_478(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_480(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_479(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_481(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_480(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_482(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_481(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_483(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_482(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_484(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_483(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_485(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_484(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_486(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_485(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_487(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_486(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_488(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_487(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_489(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_488(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_490(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_489(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_491(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_490(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_492(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_491(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_493(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_492(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_494(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_493(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_495(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_494(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_496(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_495(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_497(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_496(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_498(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_497(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_499(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_498(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_500(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_499(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_501(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_500(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_502(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_501(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_503(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_502(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_504(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_503(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_505(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_504(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_506(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_505(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_507(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_506(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_508(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_507(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_509(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_508(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_510(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_509(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_511(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_510(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_512(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_511(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_513(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_512(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_514(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_513(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_515(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_514(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_516(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_515(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_517(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_516(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_518(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_517(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_519(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_518(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_520(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_519(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_521(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_520(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_522(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_521(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_523(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_522(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_524(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_523(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_525(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_524(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_526(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_525(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_527(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_526(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_528(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_527(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_529(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_528(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_530(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_529(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_531(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_530(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_532(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_531(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_533(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_532(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_534(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_533(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_535(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_534(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_536(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_535(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_537(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_536(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_538(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_537(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_539(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_538(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_540(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_539(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_541(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_540(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_542(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_541(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_543(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_542(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_544(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_543(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_545(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_544(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_546(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_545(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_547(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_546(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_548(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_547(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_549(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_548(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_550(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_549(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_551(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_550(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_552(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_551(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_553(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_552(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_554(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_553(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_555(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_554(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_556(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_555(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_557(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_556(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_558(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_557(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_559(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_558(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_560(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_559(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_561(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_560(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_562(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_561(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_563(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_562(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_564(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_563(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_565(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_564(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_566(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_565(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_567(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_566(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_568(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_567(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_569(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_568(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_570(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_569(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_571(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_570(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_572(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_571(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_573(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_572(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_574(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_573(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_575(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_574(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_576(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_575(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_577(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_576(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_578(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_577(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_579(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_578(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_580(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_579(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_581(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_580(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_582(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_581(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_583(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_582(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_584(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_583(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_585(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_584(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_586(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_585(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_587(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_586(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_588(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_587(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_589(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_588(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_590(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_589(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_591(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_590(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_592(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_591(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_593(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_592(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_594(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_593(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_595(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_594(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_596(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_595(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_597(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_596(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_598(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_597(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_599(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_598(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_600(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_599(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_601(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_600(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_602(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_601(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_603(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_602(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_604(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_603(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_605(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_604(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_606(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_605(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_607(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_606(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_608(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_607(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_609(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_608(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_610(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_609(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_611(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_610(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_612(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_611(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_613(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_612(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_614(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_613(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_615(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_614(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_616(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_615(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_617(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_616(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_618(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_617(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_619(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_618(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_620(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_619(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_621(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_620(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_622(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_621(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_623(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_622(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_624(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_623(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_625(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_624(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_626(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_625(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_627(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_626(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_628(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_627(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_629(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_628(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_630(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_629(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_631(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_630(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_632(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_631(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_633(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_632(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_634(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_633(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_635(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_634(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_636(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_635(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_637(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_636(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_638(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_637(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_639(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_638(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_640(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_639(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_641(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_640(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_642(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_641(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_643(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_642(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_644(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_643(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_645(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_644(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_646(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_645(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_647(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_646(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_648(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_647(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_649(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_648(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_650(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_649(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_651(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_650(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_652(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_651(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_653(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_652(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_654(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_653(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_655(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_654(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_656(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_655(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_657(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_656(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_658(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_657(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_659(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_658(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_660(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_659(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_661(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_660(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_662(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_661(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_663(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_662(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_664(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_663(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_665(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_664(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_666(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_665(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_667(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_666(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_668(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_667(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_669(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_668(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_670(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_669(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_671(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_670(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_672(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_671(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_673(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_672(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_674(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_673(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_675(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_674(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_676(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_675(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_677(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_676(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_678(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_677(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_679(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_678(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_680(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_679(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_681(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_680(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_682(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_681(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_683(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_682(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_684(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_683(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_685(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_684(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_686(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_685(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_687(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_686(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_688(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_687(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_689(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_688(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_690(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_689(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_691(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_690(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_692(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_691(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_693(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_692(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_694(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_693(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_695(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_694(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_696(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_695(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_697(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_696(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_698(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_697(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_699(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_698(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_700(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_699(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_701(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_700(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_702(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_701(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_703(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_702(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_704(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_703(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_705(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_704(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_706(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_705(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_707(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_706(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_708(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_707(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_709(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_708(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_710(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_709(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_711(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_710(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_712(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_711(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_713(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_712(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_714(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_713(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_715(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_714(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_716(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_715(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_717(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_716(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_718(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_717(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_719(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_718(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_720(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_719(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_721(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_720(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_722(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_721(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_723(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_722(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_724(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_723(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_725(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_724(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_726(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_725(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_727(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_726(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_728(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_727(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_729(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_728(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_730(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_729(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_731(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_730(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_732(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_731(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_733(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_732(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_734(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_733(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_735(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_734(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_736(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_735(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_737(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_736(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_738(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_737(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_739(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_738(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_740(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_739(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_741(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_740(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_742(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_741(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_743(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_742(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_744(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_743(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_745(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_744(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_746(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_745(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_747(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_746(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_748(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_747(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_749(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_748(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_750(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_749(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_751(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_750(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_752(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_751(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_753(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_752(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_754(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_753(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_755(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_754(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_756(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_755(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_757(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_756(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_758(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_757(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_759(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_758(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_760(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_759(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_761(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_760(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_762(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_761(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_763(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_762(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_764(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_763(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_765(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_764(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_766(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_765(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_767(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_766(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_768(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_767(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_769(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_768(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_770(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_769(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_771(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_770(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_772(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_771(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_773(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_772(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_774(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_773(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_775(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_774(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_776(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_775(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_777(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_776(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_778(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_777(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_779(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_778(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_780(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_779(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_781(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_780(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_782(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_781(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_783(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_782(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_784(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_783(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_785(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_784(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_786(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_785(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_787(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_786(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_788(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_787(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_789(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_788(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_790(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_789(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_791(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_790(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_792(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_791(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_793(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_792(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_794(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_793(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_795(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_794(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_796(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_795(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_797(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_796(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_798(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_797(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_799(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_798(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_800(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_799(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_801(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_800(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_802(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_801(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_803(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_802(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_804(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_803(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_805(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_804(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_806(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_805(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_807(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_806(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_808(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_807(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_809(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_808(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_810(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_809(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_811(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_810(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_812(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_811(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_813(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_812(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_814(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_813(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_815(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_814(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_816(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_815(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_817(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_816(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_818(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_817(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_819(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_818(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_820(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_819(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_821(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_820(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_822(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_821(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_823(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_822(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_824(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_823(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_825(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_824(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_826(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_825(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_827(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_826(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_828(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_827(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_829(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_828(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_830(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_829(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_831(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_830(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_832(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_831(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_833(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_832(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_834(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_833(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_835(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_834(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_836(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_835(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_837(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_836(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_838(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_837(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_839(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_838(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_840(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_839(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_841(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_840(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_842(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_841(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_843(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_842(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_844(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_843(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_845(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_844(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_846(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_845(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_847(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_846(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_848(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_847(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_849(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_848(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_850(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_849(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_851(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_850(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_852(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_851(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_853(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_852(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_854(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_853(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_855(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_854(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_856(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_855(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_857(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_856(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_858(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_857(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_859(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_858(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_860(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_859(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_861(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_860(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_862(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_861(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_863(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_862(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_864(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_863(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_865(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_864(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_866(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_865(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_867(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_866(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_868(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_867(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_869(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_868(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_870(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_869(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_871(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_870(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_872(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_871(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_873(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_872(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_874(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_873(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_875(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_874(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_876(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_875(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_877(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_876(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_878(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_877(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_879(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_878(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_880(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_879(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_881(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_880(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_882(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_881(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_883(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_882(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_884(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_883(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_885(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_884(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_886(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_885(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_887(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_886(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_888(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_887(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_889(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_888(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_890(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_889(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_891(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_890(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_892(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_891(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_893(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_892(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_894(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_893(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_895(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_894(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_896(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_895(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_897(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_896(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_898(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_897(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_899(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_898(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_900(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_899(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_901(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_900(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_902(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_901(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_903(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_902(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_904(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_903(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_905(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_904(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_906(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_905(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_907(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_906(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_908(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_907(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_909(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_908(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_910(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_909(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_911(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_910(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_912(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_911(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_913(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_912(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_914(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_913(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_915(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_914(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_916(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_915(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_917(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_916(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_918(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_917(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_919(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_918(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_920(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_919(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_921(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_920(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_922(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_921(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_923(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_922(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_924(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_923(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_925(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_924(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_926(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_925(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_927(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_926(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_928(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_927(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_929(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_928(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_930(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_929(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_931(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_930(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_932(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_931(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_933(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_932(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_934(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_933(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_935(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_934(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_936(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_935(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_937(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_936(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_938(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_937(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_939(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_938(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_940(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_939(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_941(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_940(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_942(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_941(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_943(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_942(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_944(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_943(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_945(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_944(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_946(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_945(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_947(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_946(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_948(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_947(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_949(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_948(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_950(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_949(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_951(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_950(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_952(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_951(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_953(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_952(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_954(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_953(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_955(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_954(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_956(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_955(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_957(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_956(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_958(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_957(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_959(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_958(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_960(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_959(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_961(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_960(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_962(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_961(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_963(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_962(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_964(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_963(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_965(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_964(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_966(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_965(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_967(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_966(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_968(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_967(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_969(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_968(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_970(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_969(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_971(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_970(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_972(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_971(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_973(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_972(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_974(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_973(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_975(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_974(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_976(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_975(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_977(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_976(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_978(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_977(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_979(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_978(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_980(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_979(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_981(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_980(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_982(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_981(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_983(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_982(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_984(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_983(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_985(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_984(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_986(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_985(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_987(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_986(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_988(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_987(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_989(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_988(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_990(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_989(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_991(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_990(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_992(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_991(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_993(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_992(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_994(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_993(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_995(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_994(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_996(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_995(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_997(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_996(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_998(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_997(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_999(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_998(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1000(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_999(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1001(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1000(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1002(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1001(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1003(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1002(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1004(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1003(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1005(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1004(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1006(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1005(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1007(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1006(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1008(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1007(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1009(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1008(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1010(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1009(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1011(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1010(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1012(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1011(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1013(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1012(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1014(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1013(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1015(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1014(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1016(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1015(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1017(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1016(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1018(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1017(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1019(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1018(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1020(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1019(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1021(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1020(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1022(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1021(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1023(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1022(m, data1, data2, __VA_ARGS__)
+#define ENUM_HELPER_MAP_1024(m, data1, data2, x, ...) m(data1, data2, x) ENUM_HELPER_MAP_1023(m, data1, data2, __VA_ARGS__)
+#endif
+
+#ifdef ENUM_HELPER_REGISTRY
+#define ENUM_HELPER_REGISTRY_DECLARATION(EnumType) static const EnumHelper::EnumDescriptor EnumType##Descriptor{#EnumType, EnumType##MagicEnum};
+#else
+#define ENUM_HELPER_REGISTRY_DECLARATION(EnumType)
+#endif
+
+#define ENUM_HELPER_(Lookup, EnumType, ...)                                                                                                                                                                                                                                                                                                                              \
+    enum class EnumType                                                                                                                                                                                                                                                                                                                                                  \
+    {                                                                                                                                                                                                                                                                                                                                                                    \
+        __VA_ARGS__                                                                                                                                                                                                                                                                                                                                                      \
+    };                                                                                                                                                                                                                                                                                                                                                                   \
+    static_assert(EnumHelper::detail::enumeratorCount(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1) <= ENUM_HELPER_MAX_ENUMERATORS, "EnumHelper: more enumerators than ENUM_HELPER_MAX_ENUMERATORS");                                                                                                                                                                          \
+    static constexpr size_t EnumType##MaxKeyLength = EnumHelper::detail::longestName(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1) + 1;                                                                                                                                                                                                                                        \
+    static constexpr const EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength> EnumType##Map[] = {ENUM_HELPER_MAP(ENUM_HELPER_PAIR_CREATOR, EnumType, EnumType##MaxKeyLength, __VA_ARGS__)};                                                                                                                                                                          \
+    static constexpr std::underlying_type<EnumType>::type EnumType##Values[] = {ENUM_HELPER_MAP(ENUM_HELPER_VALUE_CREATOR, EnumType, std::underlying_type<EnumType>::type, __VA_ARGS__)};                                                                                                                                                                                \
+    static constexpr std::uint16_t EnumType##NameKeys[] = {ENUM_HELPER_MAP(ENUM_HELPER_NAME_KEY_CREATOR, EnumType, EnumType, __VA_ARGS__)};                                                                                                                                                                                                                              \
+    static_assert(EnumHelper::detail::namesDistinct(EnumType##Map, Lookup()), "EnumHelper: two enumerators differ only in case");                                                                                                                                                                                                                                        \
+    ENUM_HELPER_STATISTICS_DECLARATION(EnumType)                                                                                                                                                                                                                                                                                                                         \
+    static constexpr auto EnumType##MagicEnum = EnumHelper::MagicEnum<decltype(EnumType##Map), EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>, EnumHelper::detail::denseSpan(EnumType##Map, Lookup()), EnumHelper::detail::nameSlotWidth(EnumType##Map), Lookup>(EnumType##Map, EnumType##Values, EnumType##NameKeys ENUM_HELPER_STATISTICS_ARGUMENT(EnumType)); \
+    ENUM_HELPER_REGISTRY_DECLARATION(EnumType)                                                                                                                                                                                                                                                                                                                           \
+    struct EnumType##MagicValue : public EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>                                                                                                                                                                                                                                                                          \
+    {                                                                                                                                                                                                                                                                                                                                                                    \
+        constexpr EnumType##MagicValue(const EnumType &value) : EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>(EnumType##MagicEnum(value)) {}                                                                                                                                                                                                                    \
+        constexpr EnumType##MagicValue(const char *name) : EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>(EnumType##MagicEnum(name)) {}                                                                                                                                                                                                                          \
+        constexpr EnumType##MagicValue(const char *name, size_t length) : EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>(EnumType##MagicEnum(name, length)) {}                                                                                                                                                                                                   \
+        ENUM_HELPER_STRING_VIEW_CONSTRUCTOR(EnumType)                                                                                                                                                                                                                                                                                                                    \
+        constexpr EnumType##MagicValue(const size_t value) : EnumHelper::EnumPair<EnumType, EnumType##MaxKeyLength>(EnumType##MagicEnum(value)) {}                                                                                                                                                                                                                       \
     };
 
-#define EnumHelper(...) ENUM_HELPER_(__VA_ARGS__, Invalid)
+#define EnumHelper(...) ENUM_HELPER_(EnumHelper::lookup::Automatic, __VA_ARGS__, Invalid)
+
+/* Same as EnumHelper(...) with one of the lookup:: policies, for example EnumHelperLookup(Binary, Color, Red, Green) */
+#define EnumHelperLookup(Lookup, ...) ENUM_HELPER_(EnumHelper::lookup::Lookup, __VA_ARGS__, Invalid)
+
+/* Same interface as EnumHelper(...), but the names live in one pool instead of MaxKeyLength sized entries. Requires C++14.
+   Name lookups compare against the pool too, there are no register padded copies of the names */
+#ifdef USE_RELAXED_CONSTEXPR
+#define ENUM_HELPER_POOLED_(Lookup, EnumType, ...)                                                                                                                                                                                                                                                                        \
+    enum class EnumType                                                                                                                                                                                                                                                                                                   \
+    {                                                                                                                                                                                                                                                                                                                     \
+        __VA_ARGS__                                                                                                                                                                                                                                                                                                       \
+    };                                                                                                                                                                                                                                                                                                                    \
+    static_assert(EnumHelper::detail::enumeratorCount(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1) <= ENUM_HELPER_MAX_ENUMERATORS, "EnumHelper: more enumerators than ENUM_HELPER_MAX_ENUMERATORS");                                                                                                                           \
+    static constexpr std::underlying_type<EnumType>::type EnumType##Values[] = {ENUM_HELPER_MAP(ENUM_HELPER_VALUE_CREATOR, EnumType, std::underlying_type<EnumType>::type, __VA_ARGS__)};                                                                                                                                 \
+    static constexpr std::uint16_t EnumType##NameKeys[] = {ENUM_HELPER_MAP(ENUM_HELPER_NAME_KEY_CREATOR, EnumType, EnumType, __VA_ARGS__)};                                                                                                                                                                               \
+    static constexpr EnumHelper::PooledTable<EnumType, sizeof(EnumType##Values) / sizeof(EnumType##Values[0]), EnumHelper::detail::namePoolSize(#__VA_ARGS__)> EnumType##Pool{#__VA_ARGS__, EnumType##Values};                                                                                                            \
+    static constexpr auto &EnumType##Map = EnumType##Pool.entries;                                                                                                                                                                                                                                                        \
+    static_assert(EnumHelper::detail::namesDistinct(EnumType##Map, Lookup()), "EnumHelper: two enumerators differ only in case");                                                                                                                                                                                         \
+    ENUM_HELPER_STATISTICS_DECLARATION(EnumType)                                                                                                                                                                                                                                                                          \
+    static constexpr auto EnumType##MagicEnum = EnumHelper::MagicEnum<decltype(EnumType##Pool.entries), EnumHelper::PooledEnumPair<EnumType>, EnumHelper::detail::denseSpan(EnumType##Pool.entries, Lookup()), 0, Lookup>(EnumType##Map, EnumType##Values, EnumType##NameKeys ENUM_HELPER_STATISTICS_ARGUMENT(EnumType)); \
+    ENUM_HELPER_REGISTRY_DECLARATION(EnumType)                                                                                                                                                                                                                                                                            \
+    struct EnumType##MagicValue : public EnumHelper::PooledEnumPair<EnumType>                                                                                                                                                                                                                                             \
+    {                                                                                                                                                                                                                                                                                                                     \
+        constexpr EnumType##MagicValue(const EnumType &value) : EnumHelper::PooledEnumPair<EnumType>(EnumType##MagicEnum(value)) {}                                                                                                                                                                                       \
+        constexpr EnumType##MagicValue(const char *name) : EnumHelper::PooledEnumPair<EnumType>(EnumType##MagicEnum(name)) {}                                                                                                                                                                                             \
+        constexpr EnumType##MagicValue(const char *name, size_t length) : EnumHelper::PooledEnumPair<EnumType>(EnumType##MagicEnum(name, length)) {}                                                                                                                                                                      \
+        ENUM_HELPER_STRING_VIEW_CONSTRUCTOR(EnumType)                                                                                                                                                                                                                                                                     \
+        constexpr EnumType##MagicValue(const size_t value) : EnumHelper::PooledEnumPair<EnumType>(EnumType##MagicEnum(value)) {}                                                                                                                                                                                          \
+    };
+
+#define EnumHelperPooled(...) ENUM_HELPER_POOLED_(EnumHelper::lookup::Automatic, __VA_ARGS__, Invalid)
+#define EnumHelperPooledLookup(Lookup, ...) ENUM_HELPER_POOLED_(EnumHelper::lookup::Lookup, __VA_ARGS__, Invalid)
+#endif
 
 #define ENUM_HELPER_PAIR_CREATOR(Enum, N, x) \
     EnumHelper::toEnumPair<Enum, N>((const char *)#x, EnumHelper::detail::findKeyLength(#x), ((EnumHelper::detail::ignoreAssignment<Enum>)Enum::x).value),
 
-template <typename EnumClass, size_t N>
-std::ostream& operator<<(std::ostream& os, const EnumHelper::EnumPair<EnumClass,N>& val)
+#define ENUM_HELPER_VALUE_CREATOR(Enum, Type, x) \
+    static_cast<Type>(((EnumHelper::detail::ignoreAssignment<Enum>)Enum::x).value),
+
+#define ENUM_HELPER_NAME_KEY_CREATOR(Enum, Unused, x) \
+    EnumHelper::detail::nameKey(EnumHelper::detail::findKeyLength(#x), #x[0]),
+
+/* Formatted into a stack buffer first, so a stream sees one write per enumerator */
+template <typename Traits, typename EnumClass, size_t N>
+std::basic_ostream<char, Traits>& operator<<(std::basic_ostream<char, Traits>& os, const EnumHelper::EnumPair<EnumClass,N>& val)
 {
-    os << val.toString() << "(" << val.getIntValue() << ")";
+    char buffer[N + 32];
+    os.write(buffer, EnumHelper::toChars(buffer, buffer + sizeof(buffer), val) - buffer);
+    return os;
+}
+
+#ifdef USE_RELAXED_CONSTEXPR
+template <typename Traits, typename EnumClass>
+std::basic_ostream<char, Traits>& operator<<(std::basic_ostream<char, Traits>& os, const EnumHelper::PooledEnumPair<EnumClass>& val)
+{
+    char buffer[64];
+    char *end = EnumHelper::toChars(buffer, buffer + sizeof(buffer), val);
+    if (end == nullptr)
+    {
+        /* Only names longer than the buffer get here */
+        os.write(val.toString(), val.length);
+        end = EnumHelper::toChars(buffer, buffer + sizeof(buffer), EnumHelper::PooledEnumPair<EnumClass>{"", 0, val.value});
+    }
+    os.write(buffer, end - buffer);
     return os;
-}
\ No newline at end of file
+}
+#endif
+
+#if defined(USE_STD_FORMAT) || defined(USE_FMT_FORMAT)
+namespace EnumHelper
+{
+namespace detail
+{
+    /* Shared by the std and fmt formatters: {} gives Name(value), {:n} the name and {:v} the value */
+    template <typename FormatError>
+    struct PairFormatter
+    {
+        char presentation = '\0';
+
+        template <typename ParseContext>
+        constexpr auto parse(ParseContext &context) -> decltype(context.begin())
+        {
+            auto position = context.begin();
+            if (position != context.end() && (*position == 'n' || *position == 'v'))
+            {
+                presentation = *position++;
+            }
+            if (position != context.end() && *position != '}')
+            {
+                throw FormatError("EnumHelper: the format spec must be empty, n or v");
+            }
+            return position;
+        }
+
+        template <typename Pair, typename FormatContext>
+        auto format(const Pair &pair, FormatContext &context) const -> decltype(context.out())
+        {
+            auto out = context.out();
+            if (presentation != 'v')
+            {
+                out = std::copy_n(pair.toString(), pair.length, out);
+            }
+            if (presentation != 'n')
+            {
+                char buffer[32];
+                char *end = valueToChars(buffer + 1, buffer + sizeof(buffer) - 1, pair);
+                if (presentation == 'v')
+                {
+                    return std::copy(buffer + 1, end, out);
+                }
+                buffer[0] = '(';
+                *end++ = ')';
+                out = std::copy(buffer, end, out);
+            }
+            return out;
+        }
+    };
+}
+}
+#endif
+
+#ifdef USE_STD_FORMAT
+namespace std
+{
+template <typename EnumClass, size_t N>
+struct formatter<EnumHelper::EnumPair<EnumClass, N>> : EnumHelper::detail::PairFormatter<std::format_error>
+{
+};
+
+template <typename EnumClass>
+struct formatter<EnumHelper::PooledEnumPair<EnumClass>> : EnumHelper::detail::PairFormatter<std::format_error>
+{
+};
+}
+#endif
+
+#ifdef USE_FMT_FORMAT
+namespace fmt
+{
+template <typename EnumClass, size_t N>
+struct formatter<EnumHelper::EnumPair<EnumClass, N>> : EnumHelper::detail::PairFormatter<fmt::format_error>
+{
+};
+
+template <typename EnumClass>
+struct formatter<EnumHelper::PooledEnumPair<EnumClass>> : EnumHelper::detail::PairFormatter<fmt::format_error>
+{
+};
+}
+#endif
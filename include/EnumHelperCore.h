@@ -0,0 +1,2225 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+
+/* Included by EnumHelper.h, EnumHelperWithoutMacroMagic.h and EnumDictionary.h */
+#ifndef ENUM_HELPER_CORE_H
+#define ENUM_HELPER_CORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+#include <algorithm>
+
+#if __cplusplus >= 201703L // C++ 17 code goes here
+#define USING_STD_SEQUENCE
+#define USE_STRING_VIEW
+#define USING_STD_ARRAY
+
+#ifdef USE_STRING_VIEW
+#include <string_view>
+#endif
+
+#ifdef USING_STD_ARRAY
+#include <array>
+#endif
+
+#endif
+
+#if __cplusplus >= 201402L // C++ 14 code goes here
+#define USE_RELAXED_CONSTEXPR
+#endif
+
+/* A value lookup uses a direct index table when the values span at most
+   max(ENUM_HELPER_DENSE_MIN_SPAN, ENUM_HELPER_DENSE_FACTOR * count), otherwise a binary search */
+#ifndef ENUM_HELPER_DENSE_MIN_SPAN
+#define ENUM_HELPER_DENSE_MIN_SPAN 256
+#endif
+
+#ifndef ENUM_HELPER_DENSE_FACTOR
+#define ENUM_HELPER_DENSE_FACTOR 4
+#endif
+
+/* Widest value span lookup::Dense accepts, its index holds one entry per value in the span */
+#ifndef ENUM_HELPER_DENSE_MAX_SPAN
+#define ENUM_HELPER_DENSE_MAX_SPAN 65536
+#endif
+
+/* Sparse enums with at most this many entries are looked up at runtime by a vectorised scan of the value column */
+#ifndef ENUM_HELPER_SCAN_MAX
+#define ENUM_HELPER_SCAN_MAX 64
+#endif
+
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define USE_IS_CONSTANT_EVALUATED
+#endif
+#elif defined(__GNUC__) && __GNUC__ >= 9
+#define USE_IS_CONSTANT_EVALUATED
+#endif
+
+/* ENUM_HELPER_STATISTICS counts lookups per enum, see LookupStatistics. Off by default */
+#if defined(ENUM_HELPER_STATISTICS) && !defined(USE_IS_CONSTANT_EVALUATED)
+#error "ENUM_HELPER_STATISTICS needs __builtin_is_constant_evaluated to tell runtime lookups from constexpr ones"
+#endif
+
+#ifdef ENUM_HELPER_STATISTICS
+#include <atomic>
+#endif
+
+#if defined(__GNUC__) && defined(__SSE2__)
+#define USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) && defined(__AVX2__)
+#define USE_AVX2
+#include <immintrin.h>
+#endif
+
+/* AVX2 code paths that are compiled in anyway and picked at runtime when the CPU has it */
+#if defined(USE_SSE2) && (defined(__x86_64__) || defined(__i386__)) && !defined(USE_AVX2)
+#define USE_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+/* Name matching loads whole slots from the input, which sanitizers report when it runs past the string */
+#if defined(__SANITIZE_ADDRESS__)
+#define USE_EXACT_NAME_LOADS
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define USE_EXACT_NAME_LOADS
+#endif
+#endif
+
+namespace EnumHelper
+{
+/***************
+ * Lookup policies, how MagicEnum finds a value or a name
+ **************/
+namespace lookup
+{
+    /* Picked from the values: a direct index when they are dense, a vectorised scan of the value column
+       for small sparse enums and a binary search for large ones. Names go through a perfect hash */
+    struct Automatic
+    {
+    };
+    /* No index at all, every lookup scans the table. The smallest enum, fine for a few enumerators */
+    struct Linear
+    {
+    };
+    /* Values and names each sorted once, every lookup is a binary search */
+    struct Binary
+    {
+    };
+    /* A direct index for values however sparse, up to ENUM_HELPER_DENSE_MAX_SPAN. Names go through a perfect hash */
+    struct Dense
+    {
+    };
+    /* Names through a perfect hash, values by binary search */
+    struct Hash
+    {
+    };
+    /* Like Automatic, but names match whatever the case of their ASCII letters: "red", "RED" and "Red" are all Red */
+    struct CaseInsensitive
+    {
+    };
+}
+
+namespace detail
+{
+#ifdef USE_STRING_VIEW
+    constexpr bool stringsEqual(char const *a, char const *b)
+    {
+        return std::string_view(a) == std::string_view(b);
+    }
+#else
+    inline constexpr bool stringsEqual(char const *a, char const *b)
+    {
+        return *a == *b && (*b == '\0' || *a == '\0' || stringsEqual(a + 1, b + 1));
+    }
+#endif
+
+    /* A name that is not NUL terminated, such as a token inside a receive buffer */
+    struct NameSlice
+    {
+        const char *data;
+        size_t length;
+    };
+
+    /* How the name indices see characters, as they are or with ASCII letters folded to lower case */
+    struct ExactCase
+    {
+        static constexpr char fold(char character) { return character; }
+    };
+
+    struct FoldCase
+    {
+        static constexpr char fold(char character) { return (character >= 'A' && character <= 'Z') ? static_cast<char>(character - 'A' + 'a') : character; }
+    };
+
+    /* True when the length characters at slice spell out all of name */
+    constexpr bool sliceEqual(const char *slice, size_t length, const char *name)
+    {
+        return (length == 0) ? *name == '\0' : (*name != '\0' && *slice == *name && sliceEqual(slice + 1, length - 1, name + 1));
+    }
+
+template<typename T>
+constexpr T max(T val)
+{
+    return val;
+}
+
+template<typename T, class...Args>
+constexpr T max(T val, Args...args)
+{
+    return (val > max(args...)) ? val : max(args...);
+}
+/***************
+ * KeyNameRetriever
+ **************/
+
+/***************
+ * MakeSeq
+ **************/
+#ifdef USING_STD_SEQUENCE
+    template <size_t... Size>
+    using Seq = std::index_sequence<Size...>;
+
+    template <size_t to>
+    struct MakeSeqToImpl
+    {
+        using type = std::make_index_sequence<to>;
+    };
+#else
+    template <size_t... Size>
+    struct Seq
+    {
+    };
+
+    template <typename Front, typename Back>
+    struct concatSeq
+    {
+    };
+
+    template <size_t... Front, size_t... Back>
+    struct concatSeq<Seq<Front...>, Seq<Back...>>
+    {
+        using type = Seq<Front..., (sizeof...(Front) + Back)...>;
+    };
+
+    /* Built from halves, so a table of a thousand entries nests ten templates deep instead of a thousand */
+    template <size_t to>
+    struct MakeSeqToImpl
+    {
+        using type = typename concatSeq<typename MakeSeqToImpl<to / 2>::type, typename MakeSeqToImpl<to - to / 2>::type>::type;
+    };
+
+    template <>
+    struct MakeSeqToImpl<0>
+    {
+        using type = Seq<>;
+    };
+
+    template <>
+    struct MakeSeqToImpl<1>
+    {
+        using type = Seq<0>;
+    };
+#endif
+
+/***************
+ * ConstExprArray
+ **************/
+#ifdef USING_STD_ARRAY
+    template <typename T, size_t dim>
+    using ConstExprArray = std::array<T, dim>;
+#else
+    template <typename T, size_t dim>
+    struct ConstExprArrayStruct
+    {
+        const T arr[dim];
+        constexpr const T &operator[](size_t index) const
+        {
+            return arr[index];
+        }
+        constexpr T const *begin() const { return arr; }
+        constexpr T const *end() const { return arr + dim; }
+    };
+    template <typename T, size_t dim>
+    using ConstExprArray = ConstExprArrayStruct<T, dim>;
+#endif
+
+    /* Entries in a lookup table, a built-in array or a ConstExprArray */
+    template <typename LookupTable>
+    struct TableSize : std::extent<LookupTable>
+    {
+    };
+
+    template <typename T, size_t dim>
+    struct TableSize<ConstExprArray<T, dim>> : std::integral_constant<size_t, dim>
+    {
+    };
+
+    template <typename T, size_t LL, size_t RL, size_t... LLs, size_t... RLs>
+    constexpr ConstExprArray<T, LL + RL> join(ConstExprArray<T, LL> lhs, ConstExprArray<T, RL> rhs, detail::Seq<LLs...>, detail::Seq<RLs...>)
+    {
+        return {rhs[LLs]..., lhs[RLs]...};
+    }
+
+    template <typename T, size_t LL, size_t RL>
+    constexpr ConstExprArray<T, LL + RL> join(ConstExprArray<T, LL> lhs, ConstExprArray<T, RL> rhs)
+    {
+        return join(rhs, lhs, typename detail::MakeSeqToImpl<LL>::type(), typename detail::MakeSeqToImpl<RL>::type());
+    }
+
+    template <size_t dim>
+    constexpr ConstExprArray<const char, dim> createString(const char *csv, const size_t maxLength, const size_t index = 0)
+    {
+        return join(createString<dim / 2>(csv, maxLength, index), createString<dim - dim / 2>(csv, maxLength, index + dim / 2));
+    }
+
+    template <>
+    constexpr ConstExprArray<const char, 1> createString<1>(const char *csv, const size_t maxLength, const size_t index)
+    {
+        return {(index >= maxLength) ? '\0' : csv[index]};
+    }
+
+    /***************
+    * CSV, Used for finding max key length
+    **************/
+#ifdef USE_RELAXED_CONSTEXPR
+    /* Loops keep the constexpr depth flat, the recursive versions below nest once per character or enumerator */
+    /* Commas inside parentheses, such as those of a function call in a value, do not end an enumerator */
+    constexpr std::size_t findComma(const char *str, std::size_t startOffset = 0)
+    {
+        for (int depth = 0; str[startOffset] != '\0' && (str[startOffset] != ',' || depth > 0); ++startOffset)
+            depth += (str[startOffset] == '(') - (str[startOffset] == ')');
+        return startOffset;
+    }
+
+    constexpr size_t findEnd(const char *str, size_t startOffset = 0)
+    {
+        while (str[startOffset] != ',' && str[startOffset] != '\0' && str[startOffset] != ' ' && str[startOffset] != '=')
+            ++startOffset;
+        return startOffset;
+    }
+
+    constexpr size_t trimStart(const char *str, size_t pos)
+    {
+        while (str[pos] == ' ')
+            ++pos;
+        return pos;
+    }
+
+    constexpr std::size_t findIndex(int index, const char *str, std::size_t pos = 0)
+    {
+        std::size_t offset = 0;
+        for (; index > 0; --index)
+            offset = findComma(str, offset) + 1;
+        return pos + offset;
+    }
+
+    constexpr size_t findLastIndex(const char *str, size_t startIndex = 0)
+    {
+        for (size_t offset = findComma(str, findIndex(startIndex, str)); str[offset] != '\0'; ++startIndex)
+            offset = findComma(str, offset + 1);
+        return startIndex;
+    }
+#else
+    constexpr std::size_t findComma(const char *str, std::size_t startOffset = 0, int depth = 0)
+    {
+        return (str[startOffset] == '\0' || (str[startOffset] == ',' && depth == 0)) ? startOffset
+                                                                                     : findComma(str + 1, startOffset, depth + (str[startOffset] == '(') - (str[startOffset] == ')')) + 1;
+    }
+
+    constexpr size_t findEnd(const char *str, size_t startOffset = 0)
+    {
+        return (str[startOffset] == ',' || str[startOffset] == '\0') ? startOffset : (str[startOffset] == ' ' || str[startOffset] == '=') ? startOffset
+                                                                                                                                          : findEnd(str + 1, startOffset) + 1;
+    }
+
+    constexpr size_t trimStart(const char *str, size_t pos)
+    {
+        return (str[pos] != ' ') ? pos : trimStart(str, pos + 1);
+    }
+
+    constexpr std::size_t findIndex(int index, const char *str, std::size_t pos = 0)
+    {
+        return (index == 0) ? pos : findIndex(index - 1, str + findComma(str) + 1, findComma(str) + pos + 1);
+    }
+
+    constexpr size_t findLastIndex(const char *str, size_t startIndex = 0)
+    {
+        return (str[findComma(str, findIndex(startIndex, str))] == '\0') ? startIndex : findLastIndex(str, startIndex + 1);
+    }
+#endif
+
+    constexpr size_t findKeyLength(const char *str)
+    {
+        return findEnd(str, 0) - trimStart(str, 0);
+    }
+
+    /* Length and first character of a name in one word, which rejects most candidates without touching the name */
+    constexpr std::uint16_t nameKey(size_t length, char first)
+    {
+        return static_cast<std::uint16_t>(((length < 0xFF) ? length : 0xFF) << 8 | static_cast<unsigned char>(first));
+    }
+
+    constexpr size_t findKeyLength(size_t index, const char *str)
+    {
+        return findEnd(str, findIndex(index, str) + 1) - trimStart(str, findIndex(index, str));
+    }
+    constexpr size_t max(size_t a, size_t b)
+    {
+        return (a > b) ? a : b;
+    }
+
+#ifdef USE_RELAXED_CONSTEXPR
+    /* One pass over the first index + 1 enumerators */
+    constexpr size_t findMaxLength(const char *str, size_t index)
+    {
+        size_t longest = findEnd(str);
+        for (size_t offset = 0; index > 0 && str[findComma(str, offset)] != '\0'; --index)
+        {
+            offset = findComma(str, offset) + 1;
+            longest = max(findEnd(str, offset + 1) - trimStart(str, offset), longest);
+        }
+        return longest;
+    }
+
+    constexpr size_t findMaxLength(const char *str)
+    {
+        return findMaxLength(str, (size_t)(-1));
+    }
+#else
+    constexpr size_t findMaxLength(const char *str, size_t index)
+    {
+        return (index == 0) ? findEnd(str) : max(findKeyLength(index, str), findMaxLength(str, index - 1));
+    }
+
+    constexpr size_t findMaxLength(const char *str)
+    {
+        return findMaxLength(str, findLastIndex(str));
+    }
+#endif
+
+    /*
+     * Enumerator count and longest name of the whole stringised list, length characters long, for the
+     * macros. The C++11 versions recurse on halves of the text, so the constexpr depth is log2(length)
+     * instead of one level per enumerator.
+     */
+#ifdef USE_RELAXED_CONSTEXPR
+    constexpr size_t enumeratorCount(const char *str, size_t)
+    {
+        return findLastIndex(str) + 1;
+    }
+
+    constexpr size_t longestName(const char *str, size_t)
+    {
+        return findMaxLength(str);
+    }
+#else
+    constexpr size_t countCommas(const char *str, size_t first, size_t count)
+    {
+        return (count == 1) ? (str[first] == ',' ? 1 : 0) : countCommas(str, first, count / 2) + countCommas(str, first + count / 2, count - count / 2);
+    }
+
+    constexpr size_t enumeratorCount(const char *str, size_t length)
+    {
+        return (length == 0) ? 0 : countCommas(str, 0, length) + 1;
+    }
+
+    /* Length of the name that starts at first, 0 where no name starts */
+    constexpr size_t nameLengthAt(const char *str, size_t first)
+    {
+        return (first == 0) ? findEnd(str) : (str[first - 1] == ',') ? findEnd(str, first + 1) - trimStart(str, first) : 0;
+    }
+
+    constexpr size_t longestName(const char *str, size_t first, size_t count)
+    {
+        return (count == 1) ? nameLengthAt(str, first) : max(longestName(str, first, count / 2), longestName(str, first + count / 2, count - count / 2));
+    }
+
+    constexpr size_t longestName(const char *str, size_t length)
+    {
+        return (length == 0) ? 0 : longestName(str, 0, length);
+    }
+#endif
+
+    /* True while evaluating a constant expression, so runtime only code paths can be skipped */
+    constexpr bool isConstantEvaluated()
+    {
+#ifdef USE_IS_CONSTANT_EVALUATED
+        return __builtin_is_constant_evaluated();
+#else
+        return true;
+#endif
+    }
+
+    /***************
+    * ValueScan, runtime search of the value column
+    **************/
+#if defined(USE_SSE2) || defined(USE_AVX2)
+    template <size_t Width>
+    struct SimdEqual;
+
+    template <>
+    struct SimdEqual<1>
+    {
+#ifdef USE_SSE2
+        static __m128i splat(std::int8_t value) { return _mm_set1_epi8(value); }
+        static __m128i equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+#endif
+#ifdef USE_AVX2
+        static __m256i splat256(std::int8_t value) { return _mm256_set1_epi8(value); }
+        static __m256i equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi8(a, b); }
+#endif
+    };
+
+    template <>
+    struct SimdEqual<2>
+    {
+#ifdef USE_SSE2
+        static __m128i splat(std::int16_t value) { return _mm_set1_epi16(value); }
+        static __m128i equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+#endif
+#ifdef USE_AVX2
+        static __m256i splat256(std::int16_t value) { return _mm256_set1_epi16(value); }
+        static __m256i equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi16(a, b); }
+#endif
+    };
+
+    template <>
+    struct SimdEqual<4>
+    {
+#ifdef USE_SSE2
+        static __m128i splat(std::int32_t value) { return _mm_set1_epi32(value); }
+        static __m128i equal(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+#endif
+#ifdef USE_AVX2
+        static __m256i splat256(std::int32_t value) { return _mm256_set1_epi32(value); }
+        static __m256i equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi32(a, b); }
+#endif
+    };
+
+    /* Compares a whole register of values per step, the byte mask of the first hit gives its position */
+    template <typename T>
+    inline size_t scanValues(const T *values, size_t count, T value, std::true_type)
+    {
+        using Equal = SimdEqual<sizeof(T)>;
+        using Lane = typename std::conditional<sizeof(T) == 1, std::int8_t, typename std::conditional<sizeof(T) == 2, std::int16_t, std::int32_t>::type>::type;
+        size_t index = 0;
+#ifdef USE_AVX2
+        const __m256i needle256 = Equal::splat256(static_cast<Lane>(value));
+        for (; index + 32 / sizeof(T) <= count; index += 32 / sizeof(T))
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(values + index));
+            const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(Equal::equal(block, needle256)));
+            if (mask != 0)
+            {
+                return index + __builtin_ctz(mask) / sizeof(T);
+            }
+        }
+#endif
+#ifdef USE_SSE2
+        const __m128i needle = Equal::splat(static_cast<Lane>(value));
+        for (; index + 16 / sizeof(T) <= count; index += 16 / sizeof(T))
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + index));
+            const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(Equal::equal(block, needle)));
+            if (mask != 0)
+            {
+                return index + __builtin_ctz(mask) / sizeof(T);
+            }
+        }
+        /* The tail is covered by one last register that overlaps values already known not to match */
+        if (index < count && count >= 16 / sizeof(T))
+        {
+            index = count - 16 / sizeof(T);
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(values + index));
+            const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(Equal::equal(block, needle)));
+            return (mask != 0) ? index + __builtin_ctz(mask) / sizeof(T) : count;
+        }
+#endif
+        for (; index < count && values[index] != value; ++index)
+        {
+        }
+        return index;
+    }
+#endif
+
+    template <typename T>
+    inline size_t scanValues(const T *values, size_t count, T value, std::false_type)
+    {
+        size_t index = 0;
+        for (; index < count && values[index] != value; ++index)
+        {
+        }
+        return index;
+    }
+
+    /* Index of the first element equal to value, count when there is none */
+    template <typename T>
+    inline size_t scanValues(const T *values, size_t count, T value)
+    {
+#if defined(USE_SSE2) || defined(USE_AVX2)
+        return scanValues(values, count, value, std::integral_constant<bool, (sizeof(T) <= 4)>());
+#else
+        return scanValues(values, count, value, std::false_type());
+#endif
+    }
+
+    /***************
+    * NameCompare, runtime comparison of a name against a zero padded slot
+    **************/
+    /* Pointer to at least Width readable bytes starting with the length characters of name */
+    template <size_t Width>
+    inline const char *loadableName(const char *name, size_t length, char (&buffer)[Width])
+    {
+#ifndef USE_EXACT_NAME_LOADS
+        /* Loads that stay inside the page of name cannot fault */
+        if ((reinterpret_cast<std::uintptr_t>(name) & 4095) <= 4096 - Width)
+        {
+            return name;
+        }
+#endif
+        for (size_t character = 0; character < length; ++character)
+        {
+            buffer[character] = name[character];
+        }
+        return buffer;
+    }
+
+    inline bool sameBytesScalar(const char *a, const char *b, size_t length)
+    {
+        size_t character = 0;
+        for (; character < length && a[character] == b[character]; ++character)
+        {
+        }
+        return character == length;
+    }
+
+#ifdef USE_SSE2
+    inline bool sameBytes16(const char *a, const char *b, size_t length)
+    {
+        const __m128i equal = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(a)), _mm_loadu_si128(reinterpret_cast<const __m128i *>(b)));
+        const std::uint32_t mismatch = ~static_cast<std::uint32_t>(_mm_movemask_epi8(equal));
+        return (mismatch & ((std::uint32_t(1) << length) - 1)) == 0;
+    }
+#endif
+
+#if defined(USE_AVX2) || defined(USE_AVX2_DISPATCH)
+#ifdef USE_AVX2_DISPATCH
+    __attribute__((target("avx2")))
+#endif
+    inline bool sameBytes32(const char *a, const char *b, size_t length)
+    {
+        const __m256i equal = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a)), _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b)));
+        const std::uint64_t mismatch = ~static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(equal)));
+        return (mismatch & ((std::uint64_t(1) << length) - 1)) == 0;
+    }
+#endif
+
+#ifdef USE_AVX2_DISPATCH
+    inline bool cpuHasAvx2()
+    {
+        static const bool hasAvx2 = __builtin_cpu_supports("avx2");
+        return hasAvx2;
+    }
+#endif
+
+    /* True when the first length bytes of slot and name match, both must have Width readable bytes */
+    template <size_t Width>
+    inline bool sameBytes(const char *slot, const char *name, size_t length);
+
+    template <>
+    inline bool sameBytes<16>(const char *slot, const char *name, size_t length)
+    {
+#ifdef USE_SSE2
+        return sameBytes16(slot, name, length);
+#else
+        return sameBytesScalar(slot, name, length);
+#endif
+    }
+
+    template <>
+    inline bool sameBytes<32>(const char *slot, const char *name, size_t length)
+    {
+#if defined(USE_AVX2)
+        return sameBytes32(slot, name, length);
+#elif defined(USE_AVX2_DISPATCH)
+        return cpuHasAvx2() ? sameBytes32(slot, name, length)
+                            : (sameBytes16(slot, name, (length < 16) ? length : 16) && (length <= 16 || sameBytes16(slot + 16, name + 16, length - 16)));
+#else
+        return sameBytesScalar(slot, name, length);
+#endif
+    }
+
+    /***************
+    * Bits, for walking flag sets
+    **************/
+    constexpr int countBits(std::uint64_t bits)
+    {
+#ifdef __GNUC__
+        return __builtin_popcountll(bits);
+#else
+        return (bits == 0) ? 0 : 1 + countBits(bits & (bits - 1));
+#endif
+    }
+
+    /* Index of the lowest set bit, bits must not be 0 */
+    constexpr int trailingZeros(std::uint64_t bits)
+    {
+#ifdef __GNUC__
+        return __builtin_ctzll(bits);
+#else
+        return ((bits & 1) != 0) ? 0 : 1 + trailingZeros(bits >> 1);
+#endif
+    }
+
+    /***************
+    * NameHashIndex, perfect hash from name to table index
+    **************/
+    constexpr size_t nextPowerOfTwo(size_t value, size_t power = 1)
+    {
+        return (power >= value) ? power : nextPowerOfTwo(value, power * 2);
+    }
+
+    /* Smallest unsigned type that holds every table index plus N as the "not found" marker */
+    template <size_t N>
+    using IndexType = typename std::conditional<(N <= 0xFF), std::uint8_t,
+                                                typename std::conditional<(N <= 0xFFFF), std::uint16_t, std::uint32_t>::type>::type;
+
+    /* Wire ordinals and dictionary fields are sizeof(Word) bytes little endian, whatever the byte order of the machine */
+    template <typename Word>
+    inline void storeLittleEndian(unsigned char *bytes, std::uint64_t word)
+    {
+        for (size_t byte = 0; byte < sizeof(Word); ++byte)
+        {
+            bytes[byte] = static_cast<unsigned char>(word >> (8 * byte));
+        }
+    }
+
+    template <typename Word>
+    inline std::uint64_t loadLittleEndian(const unsigned char *bytes)
+    {
+        std::uint64_t word = 0;
+        for (size_t byte = 0; byte < sizeof(Word); ++byte)
+        {
+            word |= static_cast<std::uint64_t>(bytes[byte]) << (8 * byte);
+        }
+        return word;
+    }
+
+    /*
+     * Dictionary file, written by writeDictionary and read by EnumDictionary. Little endian, every offset
+     * counts from the start of the file, so it can be mapped at any address:
+     *   header   Magic, version u32, enum count u32, slot count u32, 0 u32, file size u64
+     *   slots    u32 per slot, open addressing by hashName of the enum name: record index + 1, 0 when empty
+     *   records  per enum: name hash u64, name offset u32, name length u32, entry count u32, entries offset u32
+     *   entries  per enumerator, Invalid included, sorted by value: value i64, name offset u32, name length u32
+     *   names    NUL terminated
+     */
+    namespace dictionary
+    {
+        constexpr const char *Magic = "EnumDict";
+        constexpr std::uint32_t Version = 1;
+
+        constexpr size_t HeaderBytes = 32;
+        constexpr size_t VersionAt = 8;
+        constexpr size_t EnumCountAt = 12;
+        constexpr size_t SlotCountAt = 16;
+        constexpr size_t FileSizeAt = 24;
+
+        constexpr size_t SlotBytes = 4;
+
+        constexpr size_t RecordBytes = 24;
+        constexpr size_t RecordHashAt = 0;
+        constexpr size_t RecordNameAt = 8;
+        constexpr size_t RecordNameLengthAt = 12;
+        constexpr size_t RecordEntryCountAt = 16;
+        constexpr size_t RecordEntriesAt = 20;
+
+        constexpr size_t EntryBytes = 16;
+        constexpr size_t EntryValueAt = 0;
+        constexpr size_t EntryNameAt = 8;
+        constexpr size_t EntryNameLengthAt = 12;
+    }
+
+#ifdef USE_RELAXED_CONSTEXPR
+    /* FNV-1a of the folded characters */
+    template <typename Fold = ExactCase>
+    constexpr std::uint64_t hashName(const char *str, size_t length)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (size_t character = 0; character < length; ++character)
+        {
+            hash = (hash ^ static_cast<unsigned char>(Fold::fold(str[character]))) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    /* Same hash as hashName(str, length) for a NUL terminated name, measuring it in the same pass */
+    template <typename Fold = ExactCase>
+    constexpr std::uint64_t hashAndMeasureName(const char *str, size_t &length)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (length = 0; str[length] != '\0'; ++length)
+        {
+            hash = (hash ^ static_cast<unsigned char>(Fold::fold(str[length]))) * 1099511628211ull;
+        }
+        return hash;
+    }
+
+    template <typename Fold = ExactCase>
+    constexpr std::uint64_t hashName(const char *str)
+    {
+        size_t length = 0;
+        return hashAndMeasureName<Fold>(str, length);
+    }
+
+    /*
+     * FNV-1a over every name with its terminator and every value as 8 bytes, in table order.
+     * How the declaration is formatted does not enter it, a value hidden behind a constant does.
+     */
+    template <typename LookupTable>
+    constexpr std::uint64_t schemaFingerprint(const LookupTable &lookupTable)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (size_t index = 0; index < TableSize<LookupTable>::value; ++index)
+        {
+            const char *name = lookupTable[index].toString();
+            for (size_t character = 0; character <= lookupTable[index].length; ++character)
+            {
+                hash = (hash ^ static_cast<unsigned char>(name[character])) * 1099511628211ull;
+            }
+            const std::uint64_t value = static_cast<std::uint64_t>(lookupTable[index].getIntValue());
+            for (size_t shift = 0; shift < 64; shift += 8)
+            {
+                hash = (hash ^ ((value >> shift) & 0xFF)) * 1099511628211ull;
+            }
+        }
+        return hash;
+    }
+
+    /* The length characters at a and at b are the same once folded */
+    template <typename Fold>
+    constexpr bool foldedEqual(const char *a, const char *b, size_t length)
+    {
+        for (size_t character = 0; character < length; ++character)
+        {
+            if (Fold::fold(a[character]) != Fold::fold(b[character]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    constexpr std::uint64_t mixHash(std::uint64_t hash, std::uint64_t seed)
+    {
+        hash ^= seed * 0x9E3779B97F4A7C15ull;
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    /*
+     * Hash and displace: every name is first hashed into one of N buckets, then each bucket
+     * gets the first seed that moves all of its names into free slots. Buckets are placed
+     * largest first so the search for a seed stays short. With FoldCase the names are hashed
+     * and compared folded, so lookups fold as they go instead of copying the name.
+     */
+    template <size_t N, typename CaseFold = ExactCase>
+    struct NameHashIndex
+    {
+        using Fold = CaseFold;
+        static constexpr size_t Buckets = N;
+        static constexpr size_t Slots = nextPowerOfTwo(2 * N);
+
+        std::uint32_t seeds[Buckets];
+        /* Table index for each slot, N if the slot is empty */
+        IndexType<N> slots[Slots];
+
+        template <typename LookupTable>
+        constexpr NameHashIndex(const LookupTable &lookupTable) : seeds{}, slots{}
+        {
+            std::uint64_t hashes[N] = {};
+            size_t bucketStart[Buckets + 1] = {};
+            size_t order[N] = {};
+
+            for (size_t slot = 0; slot < Slots; ++slot)
+            {
+                slots[slot] = static_cast<IndexType<N>>(N);
+            }
+            for (size_t index = 0; index < N; ++index)
+            {
+                hashes[index] = hashName<Fold>(lookupTable[index].toString());
+                ++bucketStart[hashes[index] % Buckets + 1];
+            }
+            size_t largest = 0;
+            for (size_t bucket = 0; bucket < Buckets; ++bucket)
+            {
+                largest = (bucketStart[bucket + 1] > largest) ? bucketStart[bucket + 1] : largest;
+                bucketStart[bucket + 1] += bucketStart[bucket];
+            }
+            size_t fill[Buckets] = {};
+            for (size_t index = 0; index < N; ++index)
+            {
+                const size_t bucket = hashes[index] % Buckets;
+                order[bucketStart[bucket] + fill[bucket]++] = index;
+            }
+
+            for (size_t size = largest; size > 0; --size)
+            {
+                for (size_t bucket = 0; bucket < Buckets; ++bucket)
+                {
+                    if (bucketStart[bucket + 1] - bucketStart[bucket] == size)
+                    {
+                        place(bucket, hashes, order + bucketStart[bucket], size);
+                    }
+                }
+            }
+        }
+
+        /* The only table index that can hold a name with this hash, N if there is none */
+        constexpr size_t candidate(std::uint64_t hash) const
+        {
+            return slots[mixHash(hash, seeds[hash % Buckets]) & (Slots - 1)];
+        }
+
+        template <typename LookupTable>
+        constexpr size_t find(const LookupTable &lookupTable, const char *name) const
+        {
+            size_t length = 0;
+            const size_t index = candidate(hashAndMeasureName<Fold>(name, length));
+            return (index < N && lookupTable[index].length == length && foldedEqual<Fold>(name, lookupTable[index].toString(), length)) ? index : (size_t)(-1);
+        }
+
+        template <typename LookupTable>
+        constexpr size_t find(const LookupTable &lookupTable, const char *name, size_t length) const
+        {
+            const size_t index = candidate(hashName<Fold>(name, length));
+            return (index < N && lookupTable[index].length == length && foldedEqual<Fold>(name, lookupTable[index].toString(), length)) ? index : (size_t)(-1);
+        }
+
+        /* Runtime only, hash must be hashName<Fold>(name, length). Padded slots only hold exact names */
+        static constexpr bool Hashed = true;
+        static constexpr bool Padded = std::is_same<Fold, ExactCase>::value;
+
+        template <typename LookupTable, typename Slots>
+        size_t match(const LookupTable &lookupTable, const Slots &slots, const char *name, size_t length, std::uint64_t hash) const
+        {
+            const size_t index = candidate(hash);
+            return (index < N && (Padded ? slots.equal(lookupTable, index, name, length)
+                                         : lookupTable[index].length == length && foldedEqual<Fold>(name, lookupTable[index].toString(), length)))
+                       ? index
+                       : (size_t)(-1);
+        }
+
+    private:
+        constexpr void place(size_t bucket, const std::uint64_t *hashes, const size_t *members, size_t size)
+        {
+            size_t candidate[N] = {};
+            for (std::uint32_t seed = 1;; ++seed)
+            {
+                bool placed = true;
+                for (size_t member = 0; member < size && placed; ++member)
+                {
+                    candidate[member] = mixHash(hashes[members[member]], seed) & (Slots - 1);
+                    placed = (slots[candidate[member]] == N);
+                    for (size_t other = 0; other < member && placed; ++other)
+                    {
+                        placed = candidate[other] != candidate[member];
+                    }
+                }
+                if (placed)
+                {
+                    seeds[bucket] = seed;
+                    for (size_t member = 0; member < size; ++member)
+                    {
+                        slots[candidate[member]] = static_cast<IndexType<N>>(members[member]);
+                    }
+                    return;
+                }
+            }
+        }
+    };
+
+    /***************
+    * NameSlots, names zero padded to one SIMD register each
+    **************/
+    /* 16 or 32 when every name fits a slot of that width, 0 when some name is longer */
+    template <typename LookupTable>
+    constexpr size_t nameSlotWidth(const LookupTable &lookupTable)
+    {
+        size_t longest = 0;
+        for (size_t index = 0; index < TableSize<LookupTable>::value; ++index)
+        {
+            const size_t length = lookupTable[index].length;
+            longest = (length > longest) ? length : longest;
+        }
+        return (longest <= 16) ? 16 : (longest <= 32) ? 32 : 0;
+    }
+
+    template <size_t N, size_t Width>
+    struct NameSlots
+    {
+        alignas(Width) char names[N][Width];
+        std::uint8_t lengths[N];
+
+        template <typename LookupTable>
+        constexpr NameSlots(const LookupTable &lookupTable) : names{}, lengths{}
+        {
+            for (size_t index = 0; index < N; ++index)
+            {
+                const char *name = lookupTable[index].toString();
+                size_t length = 0;
+                for (; name[length] != '\0'; ++length)
+                {
+                    names[index][length] = name[length];
+                }
+                lengths[index] = static_cast<std::uint8_t>(length);
+            }
+        }
+
+        /* Runtime only, one length check and one register compare */
+        template <typename LookupTable>
+        bool equal(const LookupTable &, size_t index, const char *name, size_t length) const
+        {
+            char buffer[Width] = {};
+            return lengths[index] == length && sameBytes<Width>(names[index], loadableName(name, length, buffer), length);
+        }
+    };
+
+    template <size_t N>
+    struct NameSlots<N, 0>
+    {
+        template <typename LookupTable>
+        constexpr NameSlots(const LookupTable &) {}
+
+        template <typename LookupTable>
+        bool equal(const LookupTable &lookupTable, size_t index, const char *name, size_t length) const
+        {
+            return lookupTable[index].length == length && sameBytesScalar(lookupTable[index].toString(), name, length);
+        }
+    };
+
+    /***************
+    * NameIndex, the name lookups of lookup::Linear and lookup::Binary
+    **************/
+    /* Holds nothing, every lookup compares the names in table order */
+    template <size_t N>
+    struct ScanNameIndex
+    {
+        using Fold = ExactCase;
+        static constexpr bool Hashed = false;
+        static constexpr bool Padded = false;
+
+        template <typename LookupTable>
+        constexpr ScanNameIndex(const LookupTable &) {}
+
+        template <typename LookupTable>
+        constexpr size_t find(const LookupTable &lookupTable, const char *name) const
+        {
+            for (size_t index = 0; index < N; ++index)
+            {
+                if (stringsEqual(name, lookupTable[index].toString()))
+                {
+                    return index;
+                }
+            }
+            return (size_t)(-1);
+        }
+
+        template <typename LookupTable>
+        constexpr size_t find(const LookupTable &lookupTable, const char *name, size_t length) const
+        {
+            for (size_t index = 0; index < N; ++index)
+            {
+                if (lookupTable[index].length == length && sliceEqual(name, length, lookupTable[index].toString()))
+                {
+                    return index;
+                }
+            }
+            return (size_t)(-1);
+        }
+
+        template <typename LookupTable, typename Slots>
+        size_t match(const LookupTable &lookupTable, const Slots &slots, const char *name, size_t length, std::uint64_t) const
+        {
+            for (size_t index = 0; index < N; ++index)
+            {
+                if (slots.equal(lookupTable, index, name, length))
+                {
+                    return index;
+                }
+            }
+            return (size_t)(-1);
+        }
+    };
+
+    /* Negative, zero or positive as name sorts before, equal to or after the length characters at slice */
+    constexpr int compareName(const char *name, const char *slice, size_t length)
+    {
+        size_t character = 0;
+        for (; character < length && name[character] != '\0' && name[character] == slice[character]; ++character)
+        {
+        }
+        return (character == length) ? (name[character] != '\0') : static_cast<unsigned char>(name[character]) - static_cast<unsigned char>(slice[character]);
+    }
+
+    /* Table indices ordered by name, equal names keep their table order */
+    template <size_t N>
+    struct SortedNameIndex
+    {
+        using Fold = ExactCase;
+        static constexpr bool Hashed = false;
+        static constexpr bool Padded = false;
+        IndexType<N> order[N];
+
+        template <typename LookupTable>
+        constexpr SortedNameIndex(const LookupTable &lookupTable) : order{}
+        {
+            for (size_t index = 0; index < N; ++index)
+            {
+                size_t position = index;
+                for (; position > 0 && compareName(lookupTable[index].toString(), lookupTable[order[position - 1]].toString(), lookupTable[order[position - 1]].length) < 0; --position)
+                {
+                    order[position] = order[position - 1];
+                }
+                order[position] = static_cast<IndexType<N>>(index);
+            }
+        }
+
+        template <typename LookupTable>
+        constexpr size_t find(const LookupTable &lookupTable, const char *name) const
+        {
+            size_t length = 0;
+            for (; name[length] != '\0'; ++length)
+            {
+            }
+            return find(lookupTable, name, length);
+        }
+
+        template <typename LookupTable>
+        constexpr size_t find(const LookupTable &lookupTable, const char *name, size_t length) const
+        {
+            size_t first = 0;
+            size_t count = N;
+            while (count > 0)
+            {
+                const size_t half = count / 2;
+                if (compareName(lookupTable[order[first + half]].toString(), name, length) < 0)
+                {
+                    first += half + 1;
+                    count -= half + 1;
+                }
+                else
+                {
+                    count = half;
+                }
+            }
+            return (first < N && lookupTable[order[first]].length == length && sliceEqual(name, length, lookupTable[order[first]].toString())) ? order[first] : (size_t)(-1);
+        }
+
+        template <typename LookupTable, typename Slots>
+        size_t match(const LookupTable &lookupTable, const Slots &, const char *name, size_t length, std::uint64_t) const
+        {
+            return find(lookupTable, name, length);
+        }
+    };
+
+    /***************
+    * ValueIndex, value to table index
+    **************/
+    /* The integer behind a value column, which is an enum or already an integer */
+    template <typename T, bool = std::is_enum<T>::value>
+    struct UnderlyingOf
+    {
+        using type = typename std::underlying_type<T>::type;
+    };
+
+    template <typename T>
+    struct UnderlyingOf<T, false>
+    {
+        using type = T;
+    };
+
+    /* Distance from base to value, computed in the unsigned domain so negative values work */
+    template <typename EnumType>
+    constexpr std::uintmax_t valueOffset(EnumType value, EnumType base)
+    {
+        using Underlying = typename UnderlyingOf<EnumType>::type;
+        return static_cast<std::uintmax_t>(static_cast<Underlying>(value)) - static_cast<std::uintmax_t>(static_cast<Underlying>(base));
+    }
+
+    /* Distance between the smallest and the largest value */
+    template <typename LookupTable>
+    constexpr std::uintmax_t valueSpan(const LookupTable &lookupTable)
+    {
+        auto minimum = lookupTable[0].value;
+        auto maximum = lookupTable[0].value;
+        for (size_t index = 1; index < TableSize<LookupTable>::value; ++index)
+        {
+            minimum = (lookupTable[index].value < minimum) ? lookupTable[index].value : minimum;
+            maximum = (lookupTable[index].value > maximum) ? lookupTable[index].value : maximum;
+        }
+        return valueOffset(maximum, minimum);
+    }
+
+    /* Number of slots a direct index table needs, or 0 when the values are too sparse for one */
+    template <typename LookupTable>
+    constexpr size_t denseSpan(const LookupTable &lookupTable)
+    {
+        constexpr size_t limit = max<size_t>(ENUM_HELPER_DENSE_MIN_SPAN, ENUM_HELPER_DENSE_FACTOR * TableSize<LookupTable>::value);
+        return (valueSpan(lookupTable) < limit) ? static_cast<size_t>(valueSpan(lookupTable)) + 1 : 0;
+    }
+
+    /* The span a lookup policy builds its value index for, only lookup::Automatic and lookup::Dense use one */
+    template <typename LookupTable, typename Lookup>
+    constexpr size_t denseSpan(const LookupTable &, Lookup)
+    {
+        return 0;
+    }
+
+    template <typename LookupTable>
+    constexpr size_t denseSpan(const LookupTable &lookupTable, lookup::Automatic)
+    {
+        return denseSpan(lookupTable);
+    }
+
+    template <typename LookupTable>
+    constexpr size_t denseSpan(const LookupTable &lookupTable, lookup::CaseInsensitive)
+    {
+        return denseSpan(lookupTable);
+    }
+
+    template <typename LookupTable>
+    constexpr size_t denseSpan(const LookupTable &lookupTable, lookup::Dense)
+    {
+        return (valueSpan(lookupTable) < ENUM_HELPER_DENSE_MAX_SPAN) ? static_cast<size_t>(valueSpan(lookupTable)) + 1 : 0;
+    }
+
+    template <typename EnumType, size_t N, size_t Span>
+    struct DenseValueIndex
+    {
+        EnumType minimum;
+        /* Table index for each value offset, N if no enumerator has that value */
+        IndexType<N> indices[Span];
+
+        template <typename LookupTable>
+        constexpr DenseValueIndex(const LookupTable &lookupTable) : minimum(lookupTable[0].value), indices{}
+        {
+            for (size_t index = 1; index < N; ++index)
+            {
+                minimum = (lookupTable[index].value < minimum) ? lookupTable[index].value : minimum;
+            }
+            for (size_t offset = 0; offset < Span; ++offset)
+            {
+                indices[offset] = static_cast<IndexType<N>>(N);
+            }
+            /* Backwards so the first of several equal values wins, as in a linear scan */
+            for (size_t index = N; index-- > 0;)
+            {
+                indices[valueOffset(lookupTable[index].value, minimum)] = static_cast<IndexType<N>>(index);
+            }
+        }
+
+        template <typename LookupTable>
+        constexpr size_t find(const LookupTable &, EnumType value) const
+        {
+            const std::uintmax_t offset = valueOffset(value, minimum);
+            return (offset < Span && indices[offset] != N) ? indices[offset] : (size_t)(-1);
+        }
+
+        /* Calls store(element, index) for every value, with N as index where there is no enumerator */
+        template <typename LookupTable, typename Store>
+        void findAll(const LookupTable &, const EnumType *values, size_t count, Store store) const
+        {
+            for (size_t element = 0; element < count; ++element)
+            {
+                const std::uintmax_t offset = valueOffset(values[element], minimum);
+                store(element, (offset < Span) ? indices[offset] : N);
+            }
+        }
+    };
+
+    template <typename EnumType, size_t N>
+    struct SortedValueIndex
+    {
+        /* Table indices ordered by value, equal values keep their table order */
+        IndexType<N> order[N];
+
+        template <typename LookupTable>
+        constexpr SortedValueIndex(const LookupTable &lookupTable) : order{}
+        {
+            for (size_t index = 0; index < N; ++index)
+            {
+                size_t position = index;
+                for (; position > 0 && lookupTable[index].value < lookupTable[order[position - 1]].value; --position)
+                {
+                    order[position] = order[position - 1];
+                }
+                order[position] = static_cast<IndexType<N>>(index);
+            }
+        }
+
+        template <typename LookupTable>
+        constexpr size_t find(const LookupTable &lookupTable, EnumType value) const
+        {
+            size_t first = 0;
+            size_t count = N;
+            while (count > 0)
+            {
+                const size_t half = count / 2;
+                if (lookupTable[order[first + half]].value < value)
+                {
+                    first += half + 1;
+                    count -= half + 1;
+                }
+                else
+                {
+                    count = half;
+                }
+            }
+            return (first < N && lookupTable[order[first]].value == value) ? order[first] : (size_t)(-1);
+        }
+
+        template <typename LookupTable, typename Store>
+        void findAll(const LookupTable &lookupTable, const EnumType *values, size_t count, Store store) const
+        {
+            for (size_t element = 0; element < count; ++element)
+            {
+                const size_t index = find(lookupTable, values[element]);
+                store(element, (index == (size_t)(-1)) ? N : index);
+            }
+        }
+    };
+
+    template <typename EnumType, size_t N, size_t DenseSpan>
+    using ValueIndex = typename std::conditional<(DenseSpan != 0), DenseValueIndex<EnumType, N, DenseSpan>, SortedValueIndex<EnumType, N>>::type;
+
+    /* Holds nothing, every lookup compares the values in table order */
+    template <typename EnumType, size_t N>
+    struct ScanValueIndex
+    {
+        template <typename LookupTable>
+        constexpr ScanValueIndex(const LookupTable &) {}
+
+        template <typename LookupTable>
+        constexpr size_t find(const LookupTable &lookupTable, EnumType value) const
+        {
+            for (size_t index = 0; index < N; ++index)
+            {
+                if (lookupTable[index].value == value)
+                {
+                    return index;
+                }
+            }
+            return (size_t)(-1);
+        }
+
+        template <typename LookupTable, typename Store>
+        void findAll(const LookupTable &lookupTable, const EnumType *values, size_t count, Store store) const
+        {
+            for (size_t element = 0; element < count; ++element)
+            {
+                const size_t index = find(lookupTable, values[element]);
+                store(element, (index == (size_t)(-1)) ? N : index);
+            }
+        }
+    };
+
+    /***************
+    * LookupIndices, the value and name index each lookup policy builds
+    **************/
+    template <typename Lookup, typename EnumType, size_t N, size_t DenseSpan>
+    struct LookupIndices;
+
+    template <typename EnumType, size_t N, size_t DenseSpan>
+    struct LookupIndices<lookup::Automatic, EnumType, N, DenseSpan>
+    {
+        using Values = ValueIndex<EnumType, N, DenseSpan>;
+        using Names = NameHashIndex<N>;
+        /* Runtime lookups that skip the index for a scan of the value column or of the name keys */
+        static constexpr bool ScanValues = DenseSpan == 0 && N <= ENUM_HELPER_SCAN_MAX;
+        static constexpr bool ScanNames = false;
+    };
+
+    template <typename EnumType, size_t N, size_t DenseSpan>
+    struct LookupIndices<lookup::Linear, EnumType, N, DenseSpan>
+    {
+        using Values = ScanValueIndex<EnumType, N>;
+        using Names = ScanNameIndex<N>;
+        static constexpr bool ScanValues = true;
+        static constexpr bool ScanNames = true;
+    };
+
+    template <typename EnumType, size_t N, size_t DenseSpan>
+    struct LookupIndices<lookup::Binary, EnumType, N, DenseSpan>
+    {
+        using Values = SortedValueIndex<EnumType, N>;
+        using Names = SortedNameIndex<N>;
+        static constexpr bool ScanValues = false;
+        static constexpr bool ScanNames = false;
+    };
+
+    template <typename EnumType, size_t N, size_t DenseSpan>
+    struct LookupIndices<lookup::Dense, EnumType, N, DenseSpan>
+    {
+        static_assert(DenseSpan != 0, "lookup::Dense: the values span more than ENUM_HELPER_DENSE_MAX_SPAN");
+        using Values = DenseValueIndex<EnumType, N, DenseSpan>;
+        using Names = NameHashIndex<N>;
+        static constexpr bool ScanValues = false;
+        static constexpr bool ScanNames = false;
+    };
+
+    template <typename EnumType, size_t N, size_t DenseSpan>
+    struct LookupIndices<lookup::Hash, EnumType, N, DenseSpan>
+    {
+        using Values = SortedValueIndex<EnumType, N>;
+        using Names = NameHashIndex<N>;
+        static constexpr bool ScanValues = false;
+        static constexpr bool ScanNames = false;
+    };
+
+    template <typename EnumType, size_t N, size_t DenseSpan>
+    struct LookupIndices<lookup::CaseInsensitive, EnumType, N, DenseSpan>
+    {
+        using Values = ValueIndex<EnumType, N, DenseSpan>;
+        using Names = NameHashIndex<N, FoldCase>;
+        static constexpr bool ScanValues = DenseSpan == 0 && N <= ENUM_HELPER_SCAN_MAX;
+        static constexpr bool ScanNames = false;
+    };
+
+    /* False when two names are the same once folded, the folded hash could never tell them apart */
+    template <typename LookupTable, typename Lookup>
+    constexpr bool namesDistinct(const LookupTable &, Lookup)
+    {
+        return true;
+    }
+
+    template <typename LookupTable>
+    constexpr bool namesDistinct(const LookupTable &lookupTable, lookup::CaseInsensitive)
+    {
+        for (size_t index = 0; index < TableSize<LookupTable>::value; ++index)
+        {
+            for (size_t other = index + 1; other < TableSize<LookupTable>::value; ++other)
+            {
+                if (lookupTable[index].length == lookupTable[other].length &&
+                    foldedEqual<FoldCase>(lookupTable[index].toString(), lookupTable[other].toString(), lookupTable[index].length))
+                {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+#else
+    template <typename LookupTable, typename Lookup = lookup::Automatic>
+    constexpr size_t denseSpan(const LookupTable &, Lookup = Lookup())
+    {
+        return 0;
+    }
+
+    template <typename LookupTable>
+    constexpr size_t nameSlotWidth(const LookupTable &)
+    {
+        return 0;
+    }
+
+    template <typename LookupTable, typename Lookup>
+    constexpr bool namesDistinct(const LookupTable &, Lookup)
+    {
+        return true;
+    }
+#endif
+
+    /*
+     * The value column and the name keys MagicEnum scans, taken from a table that a constexpr function built.
+     * EnumHelper.h writes both out from the macro arguments instead.
+     */
+    template <typename Underlying, size_t N>
+    struct TableColumns
+    {
+        Underlying values[N];
+        std::uint16_t nameKeys[N];
+
+        template <typename LookupTable, size_t... Indices>
+        constexpr TableColumns(const LookupTable &lookupTable, Seq<Indices...>)
+            : values{static_cast<Underlying>(lookupTable[Indices].value)...}, nameKeys{nameKey(lookupTable[Indices].length, lookupTable[Indices].toString()[0])...}
+        {
+        }
+    };
+
+    template <typename Underlying, typename LookupTable>
+    constexpr TableColumns<Underlying, TableSize<LookupTable>::value> tableColumns(const LookupTable &lookupTable)
+    {
+        return TableColumns<Underlying, TableSize<LookupTable>::value>(lookupTable, typename MakeSeqToImpl<TableSize<LookupTable>::value>::type());
+    }
+}
+
+/***************
+ * NameView
+ **************/
+/* What getName() returns, std::string_view when there is one, otherwise just the pointer and length */
+#ifdef USE_STRING_VIEW
+using NameView = std::string_view;
+#else
+struct NameView
+{
+    const char *pointer;
+    size_t length;
+    constexpr const char *data() const { return pointer; }
+    constexpr size_t size() const { return length; }
+    constexpr const char *begin() const { return pointer; }
+    constexpr const char *end() const { return pointer + length; }
+};
+#endif
+
+#ifdef ENUM_HELPER_STATISTICS
+/***************
+ * Lookup statistics
+ **************/
+/*
+ * Runtime lookup counters of one enum. Relaxed atomics, so counting never orders or blocks other threads.
+ * Every instance registers itself in a lock-free list that scrapeStatistics walks. An enum declared in a
+ * header gets one instance per translation unit that declares it.
+ */
+class LookupStatistics
+{
+    const char *enumName;
+    std::atomic<std::uint64_t> lookupCount{0};
+    std::atomic<std::uint64_t> missCount{0};
+    std::atomic<std::uint64_t> invalidCount{0};
+    LookupStatistics *next = nullptr;
+
+    static std::atomic<LookupStatistics *> &registered()
+    {
+        static std::atomic<LookupStatistics *> head{nullptr};
+        return head;
+    }
+
+public:
+    explicit LookupStatistics(const char *name) : enumName(name)
+    {
+        LookupStatistics *first = registered().load(std::memory_order_relaxed);
+        do
+        {
+            next = first;
+        } while (!registered().compare_exchange_weak(first, this, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    LookupStatistics(const LookupStatistics &) = delete;
+    LookupStatistics &operator=(const LookupStatistics &) = delete;
+
+    const char *name() const { return enumName; }
+    /* Every operator() and valuesOf lookup */
+    std::uint64_t lookups() const { return lookupCount.load(std::memory_order_relaxed); }
+    /* Lookups that found nothing and fell back to Invalid */
+    std::uint64_t misses() const { return missCount.load(std::memory_order_relaxed); }
+    /* Lookups that returned Invalid, misses included */
+    std::uint64_t invalids() const { return invalidCount.load(std::memory_order_relaxed); }
+
+    void reset()
+    {
+        lookupCount.store(0, std::memory_order_relaxed);
+        missCount.store(0, std::memory_order_relaxed);
+        invalidCount.store(0, std::memory_order_relaxed);
+    }
+
+    /* Counts a lookup that ended at index, (size_t)(-1) for a miss, and passes the index on */
+    size_t record(size_t index, size_t invalidIndex)
+    {
+        lookupCount.fetch_add(1, std::memory_order_relaxed);
+        if (index == (size_t)(-1) || index == invalidIndex)
+        {
+            missCount.fetch_add(index == (size_t)(-1), std::memory_order_relaxed);
+            invalidCount.fetch_add(1, std::memory_order_relaxed);
+        }
+        return index;
+    }
+
+    template <typename Visitor>
+    friend void scrapeStatistics(Visitor visitor);
+};
+
+/* Calls visitor(LookupStatistics &) for every registered enum, newest first */
+template <typename Visitor>
+void scrapeStatistics(Visitor visitor)
+{
+    for (LookupStatistics *statistics = LookupStatistics::registered().load(std::memory_order_acquire); statistics != nullptr; statistics = statistics->next)
+    {
+        visitor(*statistics);
+    }
+}
+
+inline void resetStatistics()
+{
+    scrapeStatistics([](LookupStatistics &statistics) { statistics.reset(); });
+}
+#endif
+
+/***************
+ * MagicEnum
+ **************/
+/*
+ * The lookups of one enum over its table, shared by both headers. EntryType is what the table holds: EnumPair,
+ * PooledEnumPair or MagicValue, anything with toString(), length and value. Lookup is one of the lookup::
+ * policies, DenseSpan is detail::denseSpan of the table for that policy.
+ */
+template <typename LookupTable, typename EntryType, size_t DenseSpan = 0, size_t NameWidth = 0, typename Lookup = lookup::Automatic>
+class MagicEnum
+{
+    static constexpr size_t Size = detail::TableSize<typename std::remove_const<LookupTable>::type>::value;
+    using EnumValue = decltype(EntryType::value);
+    using Underlying = typename std::underlying_type<EnumValue>::type;
+#ifdef USE_RELAXED_CONSTEXPR
+    using Indices = detail::LookupIndices<Lookup, EnumValue, Size, DenseSpan>;
+#else
+    static_assert(!std::is_same<Lookup, lookup::CaseInsensitive>::value, "lookup::CaseInsensitive needs C++14");
+#endif
+
+    /* The fewest bytes that hold every table index, the wire width of encode */
+    using Ordinal = detail::IndexType<Size - 1>;
+
+    const LookupTable &lookupTable;
+    /* The values of lookupTable again, contiguous so they can be scanned a register at a time */
+    const Underlying (&values)[Size];
+    /* detail::nameKey of every name, scanned like values to find the few names worth comparing */
+    const std::uint16_t (&nameKeys)[Size];
+#ifdef USE_RELAXED_CONSTEXPR
+    const typename Indices::Names nameIndex;
+    /* Only the exact perfect hash compares against padded slots */
+    const detail::NameSlots<Size, Indices::Names::Padded ? NameWidth : 0> nameSlots;
+    const typename Indices::Values valueIndex;
+#endif
+#ifdef ENUM_HELPER_STATISTICS
+    LookupStatistics *lookupStatistics;
+#endif
+
+    constexpr size_t countLookup(const size_t index) const
+    {
+#ifdef ENUM_HELPER_STATISTICS
+        return detail::isConstantEvaluated() ? index : lookupStatistics->record(index, Size - 1);
+#else
+        return index;
+#endif
+    }
+
+    constexpr const EntryType &entryOrInvalid(const size_t index) const
+    {
+        /* Invalid is always the last entry */
+        return (countLookup(index) == (size_t)(-1)) ? lookupTable[Size - 1] : lookupTable[index];
+    }
+
+    template <typename EnumType>
+    constexpr bool matches(const EnumType &value, size_t index) const
+    {
+        return value == lookupTable[index].value;
+    }
+
+    constexpr bool matches(const char *name, size_t index) const
+    {
+        return detail::stringsEqual(name, lookupTable[index].toString());
+    }
+
+    constexpr bool matches(const detail::NameSlice &name, size_t index) const
+    {
+        return name.length == lookupTable[index].length && detail::sliceEqual(name.data, name.length, lookupTable[index].toString());
+    }
+
+    static constexpr size_t ordinalOrInvalid(const size_t index)
+    {
+        return (index == (size_t)(-1)) ? Size - 1 : index;
+    }
+
+    /* Linear scan of [first, first + count) that recurses on halves, keeping the constexpr depth at log2(count) */
+    template <typename Key>
+    constexpr size_t scan(const Key &key, size_t first, size_t count) const
+    {
+        return (count == 1) ? (matches(key, first) ? first : (size_t)(-1)) : scanRest(scan(key, first, count / 2), key, first + count / 2, count - count / 2);
+    }
+
+    template <typename Key>
+    constexpr size_t scanRest(size_t found, const Key &key, size_t first, size_t count) const
+    {
+        return (found != (size_t)(-1)) ? found : scan(key, first, count);
+    }
+
+    /* Calls store(element, index) for every value, with Size as index where there is no enumerator */
+    template <typename Store>
+    void findAll(const EnumValue *input, size_t count, Store store) const
+    {
+#ifdef USE_RELAXED_CONSTEXPR
+        if (!Indices::ScanValues)
+        {
+            valueIndex.findAll(lookupTable, input, count, store);
+            return;
+        }
+#endif
+        for (size_t element = 0; element < count; ++element)
+        {
+            store(element, detail::scanValues(values, Size, static_cast<Underlying>(input[element])));
+        }
+    }
+
+public:
+    constexpr MagicEnum(const LookupTable &lookupTable, const Underlying (&values)[Size], const std::uint16_t (&nameKeys)[Size]
+#ifdef ENUM_HELPER_STATISTICS
+                        , LookupStatistics *lookupStatistics
+#endif
+                        )
+        : lookupTable(lookupTable), values(values), nameKeys(nameKeys)
+#ifdef USE_RELAXED_CONSTEXPR
+        , nameIndex(lookupTable), nameSlots(lookupTable), valueIndex(lookupTable)
+#endif
+#ifdef ENUM_HELPER_STATISTICS
+        , lookupStatistics(lookupStatistics)
+#endif
+    {
+    }
+
+    template <typename EnumType>
+    constexpr size_t indexOf(const EnumType &value, size_t index) const
+    {
+        return (index >= Size) ? (size_t)(-1) : scan(value, index, Size - index);
+    }
+
+    constexpr size_t indexOf(const EnumValue value) const
+    {
+#ifdef USE_RELAXED_CONSTEXPR
+        return (Indices::ScanValues && !detail::isConstantEvaluated()) ? scanIndexOf(value) : valueIndex.find(lookupTable, value);
+#else
+        return detail::isConstantEvaluated() ? indexOf(value, 0) : scanIndexOf(value);
+#endif
+    }
+
+    /* Runtime only */
+    size_t scanIndexOf(const EnumValue value) const
+    {
+        const size_t index = detail::scanValues(values, Size, static_cast<Underlying>(value));
+        return (index == Size) ? (size_t)(-1) : index;
+    }
+
+    constexpr size_t indexOf(const char *name, size_t index) const
+    {
+        return (index >= Size) ? (size_t)(-1) : scan(name, index, Size - index);
+    }
+
+    constexpr size_t indexOf(const char *name) const
+    {
+#ifdef USE_RELAXED_CONSTEXPR
+        return detail::isConstantEvaluated() ? nameIndex.find(lookupTable, name) : Indices::ScanNames ? prefilterIndexOf(name) : matchIndexOf(name);
+#else
+        return detail::isConstantEvaluated() ? indexOf(name, 0) : prefilterIndexOf(name);
+#endif
+    }
+
+    /* Lookup of the length characters at name, which need not be NUL terminated */
+    constexpr size_t indexOfSlice(const char *name, size_t length) const
+    {
+#ifdef USE_RELAXED_CONSTEXPR
+        if (detail::isConstantEvaluated())
+        {
+            return nameIndex.find(lookupTable, name, length);
+        }
+        return Indices::ScanNames ? prefilterIndexOf(name, length) : matchIndexOf(name, length, Indices::Names::Hashed ? detail::hashName<typename Indices::Names::Fold>(name, length) : 0);
+#else
+        return detail::isConstantEvaluated() ? scan(detail::NameSlice{name, length}, 0, Size) : prefilterIndexOf(name, length);
+#endif
+    }
+
+#ifdef USE_STRING_VIEW
+    constexpr size_t indexOf(std::string_view name) const
+    {
+        return indexOfSlice(name.data(), name.size());
+    }
+#endif
+
+    /* Runtime only, compares only the names whose length and first character match */
+    size_t prefilterIndexOf(const char *name) const
+    {
+        return prefilterIndexOf(name, std::strlen(name));
+    }
+
+    size_t prefilterIndexOf(const char *name, size_t length) const
+    {
+        const std::uint16_t key = detail::nameKey(length, (length > 0) ? name[0] : '\0');
+        for (size_t index = detail::scanValues(nameKeys, Size, key); index < Size; index += 1 + detail::scanValues(nameKeys + index + 1, Size - index - 1, key))
+        {
+            if (detail::sameBytesScalar(lookupTable[index].toString(), name, length) && lookupTable[index].toString()[length] == '\0')
+            {
+                return index;
+            }
+        }
+        return (size_t)(-1);
+    }
+
+#ifdef USE_RELAXED_CONSTEXPR
+    /* Runtime only, the name is hashed only when the name index is the perfect hash */
+    size_t matchIndexOf(const char *name) const
+    {
+        if (!Indices::Names::Hashed)
+        {
+            return matchIndexOf(name, std::strlen(name), 0);
+        }
+        size_t length = 0;
+        const std::uint64_t hash = detail::hashAndMeasureName<typename Indices::Names::Fold>(name, length);
+        return matchIndexOf(name, length, hash);
+    }
+
+    size_t matchIndexOf(const char *name, size_t length, std::uint64_t hash) const
+    {
+        return nameIndex.match(lookupTable, nameSlots, name, length, hash);
+    }
+#endif
+
+    template <typename EnumType, typename = typename std::enable_if<std::is_enum<EnumType>::value>::type>
+    constexpr const EntryType &operator()(const EnumType value) const
+    {
+        return entryOrInvalid(indexOf(value));
+    }
+
+    constexpr const EntryType &operator()(const size_t value) const
+    {
+        return entryOrInvalid(indexOf(static_cast<EnumValue>(value)));
+    }
+
+    constexpr const EntryType &operator()(const char *name) const
+    {
+        return entryOrInvalid(indexOf(name));
+    }
+
+    constexpr const EntryType &operator()(const char *name, size_t length) const
+    {
+        return entryOrInvalid(indexOfSlice(name, length));
+    }
+
+#ifdef USE_STRING_VIEW
+    constexpr const EntryType &operator()(std::string_view name) const
+    {
+        return entryOrInvalid(indexOfSlice(name.data(), name.size()));
+    }
+#endif
+
+    constexpr const EntryType &at(const size_t index) const
+    {
+        return lookupTable[index];
+    }
+
+    /* Enumerators without Invalid */
+    static constexpr size_t size() { return Size - 1; }
+
+    /* True when value lookups read a constexpr table indexed by the value, lookup::Dense or compact values under lookup::Automatic */
+    static constexpr bool hasDirectIndex() { return DenseSpan != 0; }
+
+    /* Bulk conversion, runtime only. The lookup strategy is picked once per call instead of once per element */
+
+    /* Table index of every value, (size_t)(-1) where no enumerator has the value */
+    void indicesOf(const EnumValue *input, size_t count, size_t *indices) const
+    {
+        findAll(input, count, [indices](size_t element, size_t index) { indices[element] = (index == Size) ? (size_t)(-1) : index; });
+    }
+
+    /* Name of every value, the Invalid name where no enumerator has the value */
+    void namesOf(const EnumValue *input, size_t count, const char **names) const
+    {
+        /* Invalid is the last entry, so a miss (Size) maps onto it. The table is captured by value,
+           otherwise every store to names forces the compiler to reload it */
+        const EntryType *table = &lookupTable[0];
+        findAll(input, count, [table, names](size_t element, size_t index) { names[element] = table[(index < Size) ? index : Size - 1].toString(); });
+    }
+
+    /*
+     * Value of every name. Unknown names become Invalid and get their bit set in errors,
+     * which must hold (count + 63) / 64 words. Returns the number of unknown names.
+     */
+    size_t valuesOf(const char *const *names, size_t count, EnumValue *output, std::uint64_t *errors) const
+    {
+        size_t misses = 0;
+        for (size_t word = 0; word < (count + 63) / 64; ++word)
+        {
+            errors[word] = 0;
+        }
+        for (size_t element = 0; element < count; ++element)
+        {
+#ifdef USE_RELAXED_CONSTEXPR
+            const size_t index = matchIndexOf(names[element]);
+#else
+            const size_t index = prefilterIndexOf(names[element]);
+#endif
+            const bool miss = (index == (size_t)(-1));
+            output[element] = entryOrInvalid(index).value;
+            errors[element / 64] |= std::uint64_t(miss) << (element % 64);
+            misses += miss;
+        }
+        return misses;
+    }
+
+    /*
+     * Wire encoding: the ordinal (table index) of a value, little endian in ordinalBytes() bytes.
+     * A value without an enumerator goes out as Invalid. Compare fingerprint() once per stream or
+     * file so that both sides know they number the enumerators the same way.
+     */
+    static constexpr size_t ordinalBytes() { return sizeof(Ordinal); }
+
+#ifdef USE_RELAXED_CONSTEXPR
+    /* Changes whenever a name, a value or the order of the enumerators does */
+    constexpr std::uint64_t fingerprint() const { return detail::schemaFingerprint(lookupTable); }
+#endif
+
+    constexpr size_t ordinalOf(const EnumValue value) const
+    {
+        return ordinalOrInvalid(countLookup(indexOf(value)));
+    }
+
+    /* O(1), Invalid for an ordinal past the table */
+    constexpr const EntryType &fromOrdinal(const size_t ordinal) const
+    {
+        return lookupTable[(ordinal < Size) ? ordinal : Size - 1];
+    }
+
+    /* Writes the ordinal of value and returns the end of it, nullptr when it does not fit */
+    unsigned char *encode(const EnumValue value, unsigned char *first, unsigned char *last) const
+    {
+        if (static_cast<size_t>(last - first) < sizeof(Ordinal))
+        {
+            return nullptr;
+        }
+        detail::storeLittleEndian<Ordinal>(first, ordinalOf(value));
+        return first + sizeof(Ordinal);
+    }
+
+    /* Reads one ordinal into value and returns the end of it, nullptr when there are too few bytes */
+    const unsigned char *decode(const unsigned char *first, const unsigned char *last, EnumValue &value) const
+    {
+        if (static_cast<size_t>(last - first) < sizeof(Ordinal))
+        {
+            return nullptr;
+        }
+        value = fromOrdinal(static_cast<size_t>(detail::loadLittleEndian<Ordinal>(first))).value;
+        return first + sizeof(Ordinal);
+    }
+
+    /* Ordinals of count values into count * ordinalBytes() bytes. Returns the number of values sent as Invalid for lack of an enumerator */
+    size_t encodeAll(const EnumValue *input, size_t count, unsigned char *output) const
+    {
+        size_t misses = 0;
+        findAll(input, count, [output, &misses](size_t element, size_t index) {
+            misses += (index == Size);
+            detail::storeLittleEndian<Ordinal>(output + element * sizeof(Ordinal), (index < Size) ? index : Size - 1);
+        });
+        return misses;
+    }
+
+    /* Values of count ordinals. Returns the number of ordinals past the table, which come back as Invalid */
+    size_t decodeAll(const unsigned char *input, size_t count, EnumValue *output) const
+    {
+        size_t misses = 0;
+        /* Captured like in namesOf, so stores to output do not force a reload of the table */
+        const EntryType *table = &lookupTable[0];
+        for (size_t element = 0; element < count; ++element)
+        {
+            const size_t ordinal = static_cast<size_t>(detail::loadLittleEndian<Ordinal>(input + element * sizeof(Ordinal)));
+            misses += (ordinal >= Size);
+            output[element] = table[(ordinal < Size) ? ordinal : Size - 1].value;
+        }
+        return misses;
+    }
+
+#ifdef ENUM_HELPER_STATISTICS
+    LookupStatistics &statistics() const { return *lookupStatistics; }
+#endif
+
+    constexpr const EntryType *begin() const { return &lookupTable[0]; }
+    /* Remove the last elemnt */
+    constexpr const EntryType *end() const { return &lookupTable[0] + Size - 1; }
+};
+
+/***************
+ * Enum flag handling
+ **************/
+namespace enumflags
+{
+    template <typename EnumClass>
+    class EnumFlags
+    {
+        using Bits = typename std::make_unsigned<typename std::underlying_type<EnumClass>::type>::type;
+
+    public:
+        typename std::underlying_type<EnumClass>::type flags{};
+
+        EnumFlags() = default;
+
+        constexpr EnumFlags(EnumClass flag) : flags(static_cast<typename std::underlying_type<EnumClass>::type>(flag))
+        {
+            /* Passed and returned in a register, so flag expressions fold like plain integers */
+            static_assert(std::is_trivially_copyable<EnumFlags>::value, "EnumFlags must stay trivially copyable");
+            static_assert(sizeof(EnumFlags) == sizeof(EnumClass), "EnumFlags must stay the size of its enum");
+        }
+
+        /* Visits the set bits lowest first, one count trailing zeros and one clear lowest bit per step */
+        class Iterator
+        {
+            Bits remaining;
+
+        public:
+            constexpr explicit Iterator(Bits remaining) : remaining(remaining) {}
+
+            constexpr EnumClass operator*() const { return static_cast<EnumClass>(Bits(1) << detail::trailingZeros(remaining)); }
+
+            Iterator &operator++()
+            {
+                remaining &= remaining - 1;
+                return *this;
+            }
+
+            constexpr bool operator==(const Iterator &other) const { return remaining == other.remaining; }
+            constexpr bool operator!=(const Iterator &other) const { return remaining != other.remaining; }
+        };
+
+        constexpr Iterator begin() const { return Iterator(static_cast<Bits>(flags)); }
+        constexpr Iterator end() const { return Iterator(0); }
+
+        constexpr size_t count() const { return static_cast<size_t>(detail::countBits(static_cast<Bits>(flags))); }
+        constexpr bool any() const { return flags != 0; }
+        constexpr bool none() const { return flags == 0; }
+        /* True when every bit of flag is set */
+        constexpr bool test(EnumClass flag) const
+        {
+            return (static_cast<Bits>(flags) & static_cast<Bits>(flag)) == static_cast<Bits>(flag);
+        }
+
+        /*
+         * Names of the set bits, lowest first and joined by separator, looked up in table (the EnumType##MagicEnum).
+         * Bits without an enumerator get the Invalid name. Writes at most size - 1 characters plus a NUL like
+         * snprintf and returns the full length, so a result >= size means the buffer was too small.
+         */
+        template <typename Table>
+        size_t toString(const Table &table, char *buffer, size_t size, const char *separator = "|") const
+        {
+            const size_t separatorLength = std::strlen(separator);
+            size_t length = 0;
+            for (const EnumClass flag : *this)
+            {
+                if (length != 0)
+                {
+                    length = append(buffer, size, length, separator, separatorLength);
+                }
+                const NameView name = table(flag).getName();
+                length = append(buffer, size, length, name.data(), name.size());
+            }
+            if (size != 0)
+            {
+                buffer[(length < size) ? length : size - 1] = '\0';
+            }
+            return length;
+        }
+
+    private:
+        /* Copies what still fits before the terminator, returns the length as if all of it had */
+        static size_t append(char *buffer, size_t size, size_t length, const char *chars, size_t count)
+        {
+            if (length + 1 < size)
+            {
+                std::memcpy(buffer + length, chars, (count < size - 1 - length) ? count : size - 1 - length);
+            }
+            return length + count;
+        }
+    };
+    template <typename EnumClass, typename = typename std::enable_if<std::is_enum<EnumClass>::value>::type>
+    constexpr EnumFlags<EnumClass> operator|(EnumClass l, EnumClass r) noexcept
+    {
+        return EnumFlags<EnumClass>{l} | EnumFlags<EnumClass>{r};
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> operator|(Enum l, EnumFlags<Enum> r) noexcept
+    {
+        return EnumFlags<Enum>{l} | r;
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> operator|(EnumFlags<Enum> l, Enum r) noexcept
+    {
+        return l | EnumFlags<Enum>{r};
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> operator|(EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept
+    {
+        return static_cast<Enum>(l.flags | r.flags);
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> &operator|=(EnumFlags<Enum> &l, Enum r) noexcept
+    {
+        return l = l | EnumFlags<Enum>{r};
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> &operator|=(EnumFlags<Enum> &l, EnumFlags<Enum> r) noexcept
+    {
+        return l = l | r;
+    }
+
+    template <typename Enum, typename = typename std::enable_if<std::is_enum<Enum>::value>::type>
+    constexpr EnumFlags<Enum> operator&(Enum l, Enum r) noexcept
+    {
+        return EnumFlags<Enum>{l} & EnumFlags<Enum>{r};
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> operator&(Enum l, EnumFlags<Enum> r) noexcept
+    {
+        return EnumFlags<Enum>{l} & r;
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> operator&(EnumFlags<Enum> l, Enum r) noexcept
+    {
+        return l & EnumFlags<Enum>{r};
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> operator&(EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept
+    {
+        return static_cast<Enum>(l.flags & r.flags);
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> &operator&=(EnumFlags<Enum> &l, Enum r) noexcept
+    {
+        return l = l & EnumFlags<Enum>{r};
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> &operator&=(EnumFlags<Enum> &l, EnumFlags<Enum> r) noexcept
+    {
+        return l = l & r;
+    }
+
+    template <typename Enum, typename = typename std::enable_if<std::is_enum<Enum>::value>::type>
+    constexpr EnumFlags<Enum> operator^(Enum l, Enum r) noexcept
+    {
+        return EnumFlags<Enum>{l} ^ EnumFlags<Enum>{r};
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> operator^(Enum l, EnumFlags<Enum> r) noexcept
+    {
+        return EnumFlags<Enum>{l} ^ r;
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> operator^(EnumFlags<Enum> l, Enum r) noexcept
+    {
+        return l ^ EnumFlags<Enum>{r};
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> operator^(EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept
+    {
+        return static_cast<Enum>(l.flags ^ r.flags);
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> &operator^=(EnumFlags<Enum> &l, Enum r) noexcept
+    {
+        return l = l ^ EnumFlags<Enum>{r};
+    }
+    template <typename Enum>
+    constexpr EnumFlags<Enum> &operator^=(EnumFlags<Enum> &l, EnumFlags<Enum> r) noexcept
+    {
+        return l = l ^ r;
+    }
+
+    template <typename Enum>
+    constexpr bool operator==(EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept
+    {
+        return l.flags == r.flags;
+    }
+    template <typename Enum>
+    constexpr bool operator!=(EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept
+    {
+        return l.flags != r.flags;
+    }
+
+    /* OR of the values in [first, first + count), split in halves to keep the constexpr depth at log2(count) */
+    template <typename EnumPairType>
+    constexpr EnumFlags<decltype(EnumPairType::value)> combineFlags(const EnumPairType *first, size_t count)
+    {
+        return (count == 0) ? EnumFlags<decltype(EnumPairType::value)>{}
+                            : (count == 1) ? EnumFlags<decltype(EnumPairType::value)>{first->value}
+                                           : combineFlags(first, count / 2) | combineFlags(first + count / 2, count - count / 2);
+    }
+
+    /* Every flag of the enum in one mask, Invalid left out: constexpr auto all = allFlags(EnumType##MagicEnum) */
+    template <typename Table>
+    constexpr auto allFlags(const Table &table) -> decltype(combineFlags(table.begin(), 0))
+    {
+        return combineFlags(table.begin(), static_cast<size_t>(table.end() - table.begin()));
+    }
+
+    /*
+     * Parses names separated by '|' or ',' into flags in one pass, without allocating. Spaces around names and
+     * empty names are skipped, each name is looked up in table (the EnumType##MagicEnum). Unknown names, Invalid
+     * included, are left out. Returns the offset of the first unknown name, (size_t)(-1) when every name is known.
+     */
+    template <typename Table, typename EnumClass>
+    size_t parseFlags(const Table &table, const char *text, size_t length, EnumFlags<EnumClass> &flags)
+    {
+        size_t firstUnknown = (size_t)(-1);
+        flags = EnumFlags<EnumClass>{};
+        for (size_t position = 0; position < length; ++position)
+        {
+            while (position < length && text[position] == ' ')
+            {
+                ++position;
+            }
+            const size_t start = position;
+            while (position < length && text[position] != '|' && text[position] != ',')
+            {
+                ++position;
+            }
+            size_t end = position;
+            while (end > start && text[end - 1] == ' ')
+            {
+                --end;
+            }
+            if (end == start)
+            {
+                continue;
+            }
+            const auto &entry = table(text + start, end - start);
+            if (&entry == table.end())
+            {
+                firstUnknown = (firstUnknown == (size_t)(-1)) ? start : firstUnknown;
+                continue;
+            }
+            flags |= entry.getValue();
+        }
+        return firstUnknown;
+    }
+
+#ifdef USE_STRING_VIEW
+    template <typename Table, typename EnumClass>
+    size_t parseFlags(const Table &table, std::string_view text, EnumFlags<EnumClass> &flags)
+    {
+        return parseFlags(table, text.data(), text.size(), flags);
+    }
+#endif
+}
+}
+
+#ifdef ENUM_HELPER_STATISTICS
+#define ENUM_HELPER_STATISTICS_DECLARATION(EnumType) static EnumHelper::LookupStatistics EnumType##Statistics{#EnumType};
+#define ENUM_HELPER_STATISTICS_ARGUMENT(EnumType) , &EnumType##Statistics
+#else
+#define ENUM_HELPER_STATISTICS_DECLARATION(EnumType)
+#define ENUM_HELPER_STATISTICS_ARGUMENT(EnumType)
+#endif
+
+#ifdef USE_STRING_VIEW
+#define ENUM_HELPER_STRING_VIEW_CONSTRUCTOR(EnumType) \
+    constexpr EnumType##MagicValue(std::string_view name) : EnumType##MagicValue(name.data(), name.size()) {}
+#else
+#define ENUM_HELPER_STRING_VIEW_CONSTRUCTOR(EnumType)
+#endif
+#endif
@@ -5,26 +5,13 @@
 * Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
 */
 
+#include "EnumHelperCore.h"
 #include <stdio.h>
- 
-#include <type_traits>
-#if __cplusplus>=201703L // C++ 17 code goes here
-#include <string_view>
-template< bool B, class T = void >
-using enable_if_t = std::enable_if_t<B,T>;
-#define USE_STRING_VIEW
-#define USING_STD_SEQUENCE
-#define USE_STRING_VIEW
-#define USING_STD_ARRAY
 
-#elif __cplusplus>=201402L // C++ 14 code goes here
+#if __cplusplus>=201402L // C++ 14 code goes here
 template< bool B, class T = void >
 using enable_if_t = std::enable_if_t<B,T>;
 
-#elif __cplusplus>=201103L // C++ 11 code goes here
-template< bool B, class T = void >
-using enable_if_t = typename std::enable_if<B,T>::type;
-
 #elif __cplusplus>199711L
 template< bool B, class T = void >
 using enable_if_t = typename std::enable_if<B,T>::type;
@@ -33,205 +20,72 @@ using enable_if_t = typename std::enable_if<B,T>::type;
     #error "Requires C++11 or higher"
 #endif
 
-#ifdef USE_STRING_VIEW
-#include <string_view>
-#endif
-
-#ifdef USING_STD_ARRAY
-#include <array>
-#endif
-
-/***************
- * MakeSeq
- **************/
-#include <cstddef>
+/* The CSV scanning, ConstExprArray, MagicEnum with its lookup indices and EnumFlags are shared with EnumHelper.h in EnumHelperCore.h */
 namespace EnumHelper
 {
 
 namespace detail
 {
-#ifdef USE_STRING_VIEW
-    constexpr bool stringsEqual(char const *a, char const *b)
-    {
-        return std::string_view(a) == std::string_view(b);
-    }
-#else
-    inline constexpr bool stringsEqual(char const *a, char const *b)
-    {
-        return *a == *b && (*b == '\0' || *a == '\0' || stringsEqual(a + 1, b + 1));
-    }
-#endif
-
-#ifdef USING_STD_SEQUENCE
-    template <size_t... Size>
-    using Seq = std::index_sequence<Size...>;
-#else
-    template <size_t... Size>
-    struct Seq
-    {
-    };
-#endif
-
-    template <std::size_t Prepend, typename T>
-    struct appender
-    {
-    };
-
-    template <std::size_t Prepend, std::size_t... Sizes>
-    struct appender<Prepend, Seq<Sizes...> >
-    {
-        using type = Seq<Prepend, Sizes...>;
-    };
-
-    template <std::size_t from, std::size_t to>
-    struct MakeSeqImpl
-    {
-        using type = typename appender<from, typename MakeSeqImpl<from + 1, to>::type>::type;
-    };
-
-    template <std::size_t to>
-    struct MakeSeqImpl<to, to>
-    {
-        using type = Seq<>;
-    };
-
-} // namespace detail
-
-/***************
- * ConstExprArray
- **************/
-#ifdef USING_STD_ARRAY
-    template <typename T, size_t dim>
-    using ConstExprArray = std::array<T, dim>;
-#else
-    template <typename T, std::size_t dim>
-    struct ConstExprArrayStruct
+/*********************************
+* CSV, values written after '='
+**********************************/
+#ifdef USE_RELAXED_CONSTEXPR
+constexpr size_t getEnumValueForCurrentIndex(const char* str, size_t value = 0, bool hasValue = false)
+{
+    for (; *str != '\0' && *str != ','; ++str)
     {
-        const T arr[dim];
-        constexpr ConstExprArrayStruct() = default;
-
-        constexpr const T& operator[](std::size_t index) const
-        {
-            return arr[index];
-        }
-
-        T const *begin() const
-        {
-            return arr;
-        }
-        T const *end() const
+        if (*str == '=')
         {
-            return arr + dim;
+            value = 0;
+            hasValue = true;
         }
-
-        constexpr operator const T*() const {
-            return &arr[0];
-        }
-    };
-
-    template <typename T, size_t dim>
-    struct ConstExprArrayStruct_tmp
-    {
-        const T arr[dim];
-        constexpr const T &operator[](size_t index) const
+        else if (hasValue && *str >= '0' && *str <= '9')
         {
-            return arr[index];
+            value = value*10 + *str - '0';
         }
-    };
-    template <typename T, size_t dim>
-    using ConstExprArray = ConstExprArrayStruct<T, dim>;
-#endif
-
- 
-template <typename T, std::size_t LL, std::size_t RL, std::size_t... LLs, std::size_t... RLs>
-constexpr ConstExprArray<T, LL + RL> join(ConstExprArray<T, LL> lhs, ConstExprArray<T, RL> rhs, detail::Seq<LLs...>, detail::Seq<RLs...>)
-{
-    return {rhs[LLs]..., lhs[RLs]...};
-}
-
-template <typename T, std::size_t LL, std::size_t RL>
-constexpr ConstExprArray<T, LL + RL> join(ConstExprArray<T, LL> lhs, ConstExprArray<T, RL> rhs)
-{
-    return join(rhs, lhs, typename detail::MakeSeqImpl<0, LL>::type(), typename detail::MakeSeqImpl<0, RL>::type());
-}
-
-
-/*********************************
-* CSV
-**********************************/
-constexpr std::size_t findComma(const char *str, std::size_t startOffset = 0)
-{
-    return (str[startOffset] == ',') ? startOffset : (str[startOffset] == '\0') ? startOffset : findComma(str + 1, startOffset) + 1;
-}
-
-constexpr size_t findEnd(const char *str, size_t startOffset = 0)
-{
-    return (str[startOffset] == ',' || str[startOffset] == '\0') ? startOffset : (str[startOffset] == ' ' || str[startOffset] == '=') ? startOffset : findEnd(str + 1, startOffset) + 1;
-}
-
-constexpr size_t trimStart(const char *str, size_t pos)
-{
-    return (str[pos] != ' ') ? pos : trimStart(str, pos + 1);
-}
-constexpr size_t trimEnd(const char *str, size_t pos)
-{
-    return (str[pos] != ' ') ? pos : trimEnd(str, pos - 1);
-}
-
-constexpr std::size_t findIndex(int index, const char *str, std::size_t pos = 0)
-{
-    return (index == 0) ? pos : findIndex(index - 1, str + findComma(str) + 1, findComma(str) + pos + 1);
-}
-
-constexpr int nrOfCharsOld(const char *str)
-{
-    return (*str == '\0') ? 0 : nrOfCharsOld(str + 1) + 1;
-}
-
-constexpr size_t findLastIndex(const char *str, size_t startIndex = 0)
-{
-    return (str[findComma(str, findIndex(startIndex, str))] == '\0') ? startIndex : findLastIndex(str, startIndex+1);
-}
-
-constexpr int nrOfChars(const char *str)
-{
-    return findComma(str,findIndex(findLastIndex(str),str));
+    }
+    return value;
 }
 
-constexpr size_t max(size_t a, size_t b)
+#else
+constexpr size_t getEnumValueForCurrentIndex(const char* str, size_t value = 0, bool hasValue = false)
 {
-    return (a>b)?a:b;
+    return (*str == '\0' || *str == ',') ? (
+           value
+        ) :
+        (*str == '=') ?  getEnumValueForCurrentIndex(str+1, 0, true) :
+            (hasValue && *str >= '0' && *str <= '9') ? getEnumValueForCurrentIndex(str+1, value*10 + *str - '0', hasValue) :
+                getEnumValueForCurrentIndex(str+1, value, hasValue);
 }
 
-constexpr size_t findKeyLength(size_t index, const char* str)
+/* The value written at offset, or the one after previous when there is none */
+constexpr size_t getEnumValueAfter(const char* str, size_t offset, size_t previous)
 {
-    return findEnd(str, findIndex(index ,str)+1)-trimStart(str,findIndex(index,str));    
+    return (getEnumValueForCurrentIndex(&str[offset]) != 0) ? getEnumValueForCurrentIndex(&str[offset]) : previous + 1;
 }
 
-constexpr size_t findMaxLength(const char *str, size_t index)
-{
-    return (index == 0) ? findEnd(str) : max(findKeyLength(index, str), findMaxLength(str, index-1))+1;
-}
-constexpr size_t findMaxLength(const char *str)
+/* Where an enumerator starts and the value it has, carried from one enumerator to the next */
+struct EnumeratorPosition
 {
-    return findMaxLength(str, findLastIndex(str));
-}
+    size_t offset;
+    size_t value;
+};
 
-constexpr size_t getEnumValueForCurrentIndex(const char* str, size_t value = 0, bool hasValue = false)
+constexpr EnumeratorPosition enumeratorAt(const char* str, size_t offset, size_t previous)
 {
-    return (*str == '\0' || *str == ',') ? (
-           value
-        ) :
-        (*str == '=') ?  getEnumValueForCurrentIndex(str+1, 0, true) :
-            (hasValue && *str >= '0' && *str <= '9') ? getEnumValueForCurrentIndex(str+1, value*10 + *str - '0', hasValue) :
-                getEnumValueForCurrentIndex(str+1, value, hasValue);
+    return {offset, getEnumValueAfter(str, offset, previous)};
 }
 
-constexpr size_t getEnumValueForIndex(const char* str, size_t index)
+/* The enumerator count places after position. The second half starts where the first ended, so the
+   constexpr depth grows with log2(count) and nothing walks the list from its start again */
+constexpr EnumeratorPosition skipEnumerators(const char* str, EnumeratorPosition position, size_t count)
 {
-    return (index == 0) ? getEnumValueForCurrentIndex(&str[findIndex(index,str)]) : 
-        (getEnumValueForCurrentIndex(&str[findIndex(index,str)]) != 0) ? getEnumValueForCurrentIndex(&str[findIndex(index,str)]) : getEnumValueForIndex(str, index-1) + 1;
+    return (count == 0) ? position :
+        (count == 1) ? enumeratorAt(str, findComma(str, position.offset) + 1, position.value) :
+            skipEnumerators(str, skipEnumerators(str, position, count/2), count - count/2);
 }
+#endif
+} // namespace detail
 
 /*********************************
 * Build lookup
@@ -240,250 +94,160 @@ template <typename EnumType, std::size_t N>
 class MagicValue
 {
     public:
-    const ConstExprArray<char,N> key;
-    size_t value;
+    const detail::ConstExprArray<const char,N> key;
+    /* Computed with the table, so no caller has to strlen the name */
+    size_t length;
+    EnumType value;
 
     constexpr MagicValue() = delete;
-    constexpr MagicValue(const ConstExprArray<char,N> key, size_t value) : key(key), value(value) {};
+    constexpr MagicValue(const detail::ConstExprArray<const char,N> key, size_t length, size_t value) : key(key), length(length), value(static_cast<EnumType>(value)) {};
 
     constexpr const char* toString() const
     {
         return &key[0];
     }
 
+    constexpr NameView getName() const
+    {
+        return NameView{&key[0], length};
+    }
+
     constexpr const EnumType getValue() const
     {
-        return static_cast<EnumType>(value);
+        return value;
     }
 
     constexpr size_t getIntValue() const
     {
-        return value;
+        return static_cast<size_t>(value);
     }
 
     constexpr bool hasValue() const
     {
-        return value != static_cast<size_t>(EnumType::Invalid);
+        return value != EnumType::Invalid;
     }
 
-    constexpr ConstExprArray<char,N> getConstArray()  const { return key;}
+    constexpr detail::ConstExprArray<const char,N> getConstArray()  const { return key;}
 
     constexpr operator size_t() const { return getIntValue();}
     constexpr operator char*()  const { return toString();}
-    constexpr operator ConstExprArray<char,N>()  const { return key;}
+    constexpr operator detail::ConstExprArray<const char,N>()  const { return key;}
     constexpr operator EnumType()  const { return getValue();}
 };
 
+#ifdef USE_RELAXED_CONSTEXPR
+namespace detail
+{
+/*
+ * Name, length and value of every enumerator, parsed in one walk over the list that carries the offset from
+ * one enumerator to the next. Finding each enumerator from the start of the list instead made building the
+ * table quadratic, and ran into the constexpr operation limit at a few hundred enumerators.
+ */
+template <std::size_t N, std::size_t Count>
+struct ParsedEnumerators
+{
+    char names[Count][N];
+    size_t lengths[Count];
+    size_t values[Count];
 
-template<std::size_t dim>
-constexpr ConstExprArray<char, dim> createString(const char* csv, const size_t maxLength, const size_t index = 0)
+    constexpr ParsedEnumerators(const char* csv) : names{}, lengths{}, values{}
+    {
+        size_t offset = 0;
+        for (size_t index = 0; index < Count; ++index)
+        {
+            const size_t start = trimStart(csv, offset);
+            lengths[index] = findEnd(csv, start) - start;
+            for (size_t character = 0; character < lengths[index]; ++character)
+            {
+                names[index][character] = csv[start + character];
+            }
+            /* An enumerator without a value follows the previous one */
+            const size_t current = getEnumValueForCurrentIndex(&csv[offset]);
+            values[index] = (index == 0 || current != 0) ? current : values[index - 1] + 1;
+            offset = findComma(csv, offset) + 1;
+        }
+    }
+
+    template <size_t... Characters>
+    constexpr ConstExprArray<const char, N> key(size_t index, Seq<Characters...>) const
+    {
+        return {{names[index][Characters]...}};
+    }
+};
+} // namespace detail
+
+template<typename ElementType, std::size_t N, std::size_t dim, std::size_t Count, class = enable_if_t<dim == 1>>
+constexpr detail::ConstExprArray<ElementType, 1> createLookupTable(const detail::ParsedEnumerators<N, Count>& parsed, const size_t index)
 {
-    return join(createString<dim/2>(csv, maxLength, index), createString<dim-dim/2>(csv, maxLength, index+dim/2));
+    return {ElementType(parsed.key(index, typename detail::MakeSeqToImpl<N>::type()), parsed.lengths[index], parsed.values[index])};
 }
 
-template<>
-constexpr ConstExprArray<char, 1> createString<1>(const char* csv, const size_t maxLength, const size_t index)
+template<typename ElementType, std::size_t N, std::size_t dim, std::size_t Count, class = enable_if_t<! (dim == 1)> >
+constexpr detail::ConstExprArray<ElementType, dim> createLookupTable(const detail::ParsedEnumerators<N, Count>& parsed, const size_t index)
 {
-    return {(index >= maxLength)? '\0':csv[index]};
+    return detail::join(createLookupTable<ElementType, N, dim/2>(parsed, index), createLookupTable<ElementType, N, dim-dim/2>(parsed, index+dim/2));
 }
 
-template<typename ElementType, std::size_t N, std::size_t dim, class = enable_if_t<dim == 1>>
-constexpr ConstExprArray<ElementType, 1> createLookupTable(const char* csv, const size_t index)
+template<typename ElementType, std::size_t N, std::size_t dim>
+constexpr detail::ConstExprArray<ElementType, dim> createLookupTable(const char* csv)
 {
-    return {ElementType(createString<N>(&csv[trimStart(csv,findIndex(index, csv))], findKeyLength(index, csv)), getEnumValueForIndex(csv, index))};
+    return createLookupTable<ElementType, N, dim>(detail::ParsedEnumerators<N, dim>(csv), 0);
 }
-
-template<typename ElementType, std::size_t N, std::size_t dim,class = enable_if_t<! (dim == 1)> >
-constexpr ConstExprArray<ElementType, dim> createLookupTable(const char* csv, const size_t index=0)
+#else
+/* The C++11 counterpart of ParsedEnumerators: each half of the table starts from the position where the first
+   half's enumerators end, so the list is walked once per level and the constexpr depth stays logarithmic */
+template<typename ElementType, std::size_t N>
+constexpr ElementType createEntry(const char* name, size_t value)
 {
-    return join(createLookupTable<ElementType, N, dim/2>(csv, index), createLookupTable<ElementType, N, dim-dim/2>(csv, index+dim/2));
+    return ElementType(detail::createString<N>(name, detail::findKeyLength(name)), detail::findKeyLength(name), value);
 }
 
-
-/*********************************
-* Magic Enum
-**********************************/
-template <typename LookupTable, typename T, typename LookupTableElementType>
-class MagicEnum
+template<typename ElementType, std::size_t N, std::size_t dim, class = enable_if_t<dim == 1>>
+constexpr detail::ConstExprArray<ElementType, 1> createLookupTable(const char* csv, const detail::EnumeratorPosition position)
 {
-    public:
-    const LookupTable &lookupTable;
-    constexpr MagicEnum(const LookupTable& lookupTable) :  lookupTable(lookupTable) {}
-
-    template <typename EnumClassType>
-    constexpr size_t indexOf(const EnumClassType value, size_t index = 0) const
-    {
-        return (index >= sizeof(lookupTable)/sizeof(lookupTable[0])) ? -1 :
-            (static_cast<size_t>(value) == lookupTable[index].value) ? index :
-                indexOf<EnumClassType>(value, index+1);
-    }
-
-    constexpr size_t indexOf(const char* name, size_t index = 0) const
-    {
-        return (index >= sizeof(lookupTable)/sizeof(lookupTable[0])) ? -1 :
-            (detail::stringsEqual(name, lookupTable[index].toString())) ? index :
-                indexOf(name, index+1);
-    }
-
-    template <typename EnumClassType>
-    constexpr const LookupTableElementType& operator()(const EnumClassType value) const
-    {
-        return (indexOf(value) == (size_t)-1) ? lookupTable[indexOf("Invalid")] : lookupTable[indexOf(value)];
-    }
-
-    constexpr const LookupTableElementType& operator()(const size_t value) const
-    {
-        return (indexOf(value) == (size_t)-1) ? lookupTable[indexOf("Invalid")] : lookupTable[indexOf(value)];
-    }
-
-    constexpr const LookupTableElementType& operator()(const char* name) const
-    {
-        return (indexOf(name) == (size_t)-1) ? lookupTable[indexOf("Invalid")] : lookupTable[indexOf(name)];
-    }
-
-    class const_iterator 
-    {
-        public:
-        friend class MagicEnum;
-        const LookupTableElementType* m_element{};
-        size_t m_index = 0;
-        T m_value{};
-
-        const_iterator (const LookupTableElementType* element) : m_element(element) {}
+    return {createEntry<ElementType, N>(&csv[detail::trimStart(csv, position.offset)], position.value)};
+}
 
-        const LookupTableElementType& operator * ()  {
-            return m_element[m_index];
-        }
+template<typename ElementType, std::size_t N, std::size_t dim, class = enable_if_t<! (dim == 1)> >
+constexpr detail::ConstExprArray<ElementType, dim> createLookupTable(const char* csv, const detail::EnumeratorPosition position)
+{
+    return detail::join(createLookupTable<ElementType, N, dim/2>(csv, position), createLookupTable<ElementType, N, dim-dim/2>(csv, detail::skipEnumerators(csv, position, dim/2)));
+}
 
-        const_iterator& operator++ ()
-        {   
-            m_index++;
-            return *this;
-        }
-        
-        const_iterator& operator-- ()
-        {   
-            m_index--;
-            return *this;
-        }
+template<typename ElementType, std::size_t N, std::size_t dim>
+constexpr detail::ConstExprArray<ElementType, dim> createLookupTable(const char* csv)
+{
+    return createLookupTable<ElementType, N, dim>(csv, detail::EnumeratorPosition{0, detail::getEnumValueForCurrentIndex(csv)});
+}
+#endif
 
-        bool operator != (const const_iterator& rhs) const
-        {
-            return &m_element[m_index] != &rhs.m_element[rhs.m_index];
-        }
 
-        const_iterator () : m_element(0) {}
-    };
-    
-    const_iterator  begin() const { return const_iterator(lookupTable.begin()); }
-    /* Remove the last Invalid Enum */
-    const_iterator  end() const { return const_iterator(lookupTable.end() - 1); }
-};
 } //EnumHelper
 
-#define EnumHelper2(ClassName, ...) \
+#define EnumHelper2(Lookup, ClassName, ...) \
     enum class ClassName : size_t  \
     {                              \
         __VA_ARGS__                \
     };                             \
     constexpr static auto *ClassName##Str = static_cast<const char *>(#__VA_ARGS__); \
-    constexpr static auto ClassName##LookupTable = EnumHelper::createLookupTable<EnumHelper::MagicValue<ClassName, EnumHelper::findMaxLength(ClassName##Str)>, EnumHelper::findMaxLength(ClassName##Str), EnumHelper::findLastIndex(ClassName##Str)+1>(ClassName##Str); \
-    constexpr static auto ClassName##MagicEnum = EnumHelper::MagicEnum<decltype(ClassName##LookupTable), ClassName, EnumHelper::MagicValue<ClassName, EnumHelper::findMaxLength(ClassName##Str)>>(ClassName##LookupTable); \
-    struct ClassName##MagicValue : public EnumHelper::MagicValue<ClassName, EnumHelper::findMaxLength(ClassName##Str)>{        \
-        constexpr ClassName##MagicValue(const Color &value) : EnumHelper::MagicValue<ClassName, EnumHelper::findMaxLength(ClassName##Str)>(ClassName##MagicEnum(value)) { } \
-        constexpr ClassName##MagicValue(const char* value) : EnumHelper::MagicValue<ClassName, EnumHelper::findMaxLength(ClassName##Str)>(ClassName##MagicEnum(value)) { } \
-        constexpr ClassName##MagicValue(const size_t value) : EnumHelper::MagicValue<ClassName, EnumHelper::findMaxLength(ClassName##Str)>(ClassName##MagicEnum(value)) { } \
+    constexpr static size_t ClassName##MaxKeyLength = EnumHelper::detail::longestName(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1) + 1; \
+    constexpr static auto ClassName##LookupTable = EnumHelper::createLookupTable<EnumHelper::MagicValue<ClassName, ClassName##MaxKeyLength>, ClassName##MaxKeyLength, EnumHelper::detail::enumeratorCount(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)>(ClassName##Str); \
+    constexpr static auto ClassName##Columns = EnumHelper::detail::tableColumns<size_t>(ClassName##LookupTable); \
+    static_assert(EnumHelper::detail::namesDistinct(ClassName##LookupTable, Lookup()), "EnumHelper: two enumerators differ only in case"); \
+    ENUM_HELPER_STATISTICS_DECLARATION(ClassName) \
+    constexpr static auto ClassName##MagicEnum = EnumHelper::MagicEnum<decltype(ClassName##LookupTable), EnumHelper::MagicValue<ClassName, ClassName##MaxKeyLength>, \
+        EnumHelper::detail::denseSpan(ClassName##LookupTable, Lookup()), EnumHelper::detail::nameSlotWidth(ClassName##LookupTable), Lookup>(ClassName##LookupTable, \
+        ClassName##Columns.values, ClassName##Columns.nameKeys ENUM_HELPER_STATISTICS_ARGUMENT(ClassName)); \
+    struct ClassName##MagicValue : public EnumHelper::MagicValue<ClassName, ClassName##MaxKeyLength>{        \
+        constexpr ClassName##MagicValue(const ClassName &value) : EnumHelper::MagicValue<ClassName, ClassName##MaxKeyLength>(ClassName##MagicEnum(value)) { } \
+        constexpr ClassName##MagicValue(const char* value) : EnumHelper::MagicValue<ClassName, ClassName##MaxKeyLength>(ClassName##MagicEnum(value)) { } \
+        constexpr ClassName##MagicValue(const char* name, size_t length) : EnumHelper::MagicValue<ClassName, ClassName##MaxKeyLength>(ClassName##MagicEnum(name, length)) { } \
+        ENUM_HELPER_STRING_VIEW_CONSTRUCTOR(ClassName) \
+        constexpr ClassName##MagicValue(const size_t value) : EnumHelper::MagicValue<ClassName, ClassName##MaxKeyLength>(ClassName##MagicEnum(value)) { } \
     };
-#define EnumHelper(...) EnumHelper2(__VA_ARGS__, Invalid)
-
-namespace bitset
-{
-    template <typename EnumClass>
-    class EnumFlags {
-
-        public:
-            typename std::underlying_type<EnumClass>::type flags{};
-            EnumFlags() = default;
+#define EnumHelper(...) EnumHelper2(EnumHelper::lookup::Automatic, __VA_ARGS__, Invalid)
+/* Same as EnumHelper(...) with one of the lookup:: policies, for example EnumHelperLookup(Binary, Color, Red, Green) */
+#define EnumHelperLookup(Lookup, ...) EnumHelper2(EnumHelper::lookup::Lookup, __VA_ARGS__, Invalid)
 
-            EnumFlags(EnumClass flag)
-            {
-                flags = static_cast<typename std::underlying_type<EnumClass>::type>(flag);
-            }
-    };
-
-    template < typename EnumClass >
-    constexpr EnumFlags<EnumClass> operator | (EnumClass l, EnumClass r) noexcept {
-        return EnumFlags<EnumClass>{l} | EnumFlags<EnumClass>{r};
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator | (Enum l, EnumFlags<Enum> r) noexcept {
-        return EnumFlags<Enum>{l} | r;
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator | (EnumFlags<Enum> l, Enum r) noexcept {
-        return l | EnumFlags<Enum>{r};
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator | (EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept {
-        return static_cast<Enum>(l.flags | r.flags);
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum>& operator |= (EnumFlags<Enum>& l, Enum r) noexcept {
-        return l = l | EnumFlags<Enum>{r};
-    }
-    template < typename Enum >
-        constexpr EnumFlags<Enum>& operator |= (EnumFlags<Enum>& l, EnumFlags<Enum> r) noexcept {
-        return l = l | r;
-    }
-
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator & (Enum l, Enum r) noexcept {
-        return EnumFlags<Enum>{l} & EnumFlags<Enum>{r};
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator & (Enum l, EnumFlags<Enum> r) noexcept {
-        return EnumFlags<Enum>{l} & r;
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator & (EnumFlags<Enum> l, Enum r) noexcept {
-        return l & EnumFlags<Enum>{r};
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator & (EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept {
-        return static_cast<Enum>(l.flags & r.flags);
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum>& operator &= (EnumFlags<Enum>& l, Enum r) noexcept {
-        return l = l & EnumFlags<Enum>{r};
-    }
-    template < typename Enum >
-        constexpr EnumFlags<Enum>& operator &= (EnumFlags<Enum>& l, EnumFlags<Enum> r) noexcept {
-        return l = l & r;
-    }
-
-
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator ^ (Enum l, Enum r) noexcept {
-        return EnumFlags<Enum>{l} ^ EnumFlags<Enum>{r};
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator ^ (Enum l, EnumFlags<Enum> r) noexcept {
-        return EnumFlags<Enum>{l} ^ r;
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator ^ (EnumFlags<Enum> l, Enum r) noexcept {
-        return l ^ EnumFlags<Enum>{r};
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum> operator ^ (EnumFlags<Enum> l, EnumFlags<Enum> r) noexcept {
-        return static_cast<Enum>(l.flags ^ r.flags);
-    }
-    template < typename Enum >
-    constexpr EnumFlags<Enum>& operator ^= (EnumFlags<Enum>& l, Enum r) noexcept {
-        return l = l ^ EnumFlags<Enum>{r};
-    }
-    template < typename Enum >
-        constexpr EnumFlags<Enum>& operator ^= (EnumFlags<Enum>& l, EnumFlags<Enum> r) noexcept {
-        return l = l ^ r;
-    }
-}
\ No newline at end of file
+/* The flag operators are EnumHelper::enumflags, shared with EnumHelper.h */
+namespace bitset = EnumHelper::enumflags;
@@ -0,0 +1,28 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+
+/* Checks shared by the tests, each test is a plain program that ctest runs */
+#ifndef ENUM_HELPER_CHECK_H
+#define ENUM_HELPER_CHECK_H
+
+#include <cstdio>
+
+/* Failed checks so far, main returns it so that ctest sees the failure */
+static int failures = 0;
+
+/* Reports a failed condition and carries on, so one run shows every failure */
+#define CHECK(condition)                                                         \
+    do                                                                           \
+    {                                                                            \
+        if (!(condition))                                                        \
+        {                                                                        \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++failures;                                                          \
+        }                                                                        \
+    } while (0)
+
+#endif
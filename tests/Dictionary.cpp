@@ -0,0 +1,187 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#define ENUM_HELPER_REGISTRY
+#include "EnumHelper.h"
+#include "EnumDictionary.h"
+#include "Check.h"
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+EnumHelper(Color, Red = 3, Green = -9, Blue = 400, Crimson = 3);
+EnumHelperPooled(Shape, Circle, Square = 7);
+EnumHelperLookup(Dense, Opcode, Load = 3, Store = 17, Add = 40, Jump = 200);
+
+namespace format = EnumHelper::detail::dictionary;
+using Bytes = std::vector<unsigned char>;
+
+static Bytes writeAll()
+{
+    Bytes bytes(EnumHelper::writeDictionary(nullptr, nullptr));
+    EnumHelper::writeDictionary(bytes.data(), bytes.data() + bytes.size());
+    return bytes;
+}
+
+static bool attaches(const Bytes &bytes)
+{
+    EnumHelper::EnumDictionary dictionary;
+    return dictionary.attach(bytes.data(), bytes.size());
+}
+
+/* A copy of bytes with a 32 bit field replaced */
+static Bytes patched(const Bytes &bytes, size_t at, std::uint64_t value)
+{
+    Bytes copy(bytes);
+    EnumHelper::detail::storeLittleEndian<std::uint32_t>(copy.data() + at, value);
+    return copy;
+}
+
+static bool inside(const Bytes &bytes, const char *name)
+{
+    const unsigned char *at = reinterpret_cast<const unsigned char *>(name);
+    return name == nullptr || (at >= bytes.data() && at + std::strlen(name) < bytes.data() + bytes.size());
+}
+
+/* Whatever a dictionary that attached holds, every name it hands out lies inside it */
+static bool namesInside(const Bytes &bytes, const EnumHelper::EnumDictionary &dictionary)
+{
+    bool ok = true;
+    for (size_t index = 0; index < dictionary.enumCount(); ++index)
+    {
+        const EnumHelper::EnumDictionary::Enum found = dictionary.enumAt(index);
+        ok = ok && inside(bytes, found.name());
+        for (long long value = -20; value <= 420; ++value)
+        {
+            ok = ok && inside(bytes, found.nameOf(value));
+        }
+    }
+    return ok && inside(bytes, dictionary.nameOf("Color", 3));
+}
+
+/* Every name of every registered enum comes back as the enum names it */
+template <typename Magic>
+static void checkEnum(const EnumHelper::EnumDictionary &dictionary, const char *name, const Magic &magic)
+{
+    const EnumHelper::EnumDictionary::Enum found = dictionary.find(name);
+    CHECK(found && std::strcmp(found.name(), name) == 0 && found.size() == magic.size() + 1);
+    for (long long value = -20; value <= 420; ++value)
+    {
+        const size_t index = magic.indexOf(static_cast<decltype(magic.at(0).getValue())>(value));
+        const char *expected = (index == (size_t)(-1)) ? nullptr : magic.at(index).toString();
+        const char *actual = found.nameOf(value);
+        CHECK((expected == nullptr) ? actual == nullptr : actual != nullptr && std::strcmp(expected, actual) == 0);
+    }
+}
+
+static void checkRoundTrip(const Bytes &bytes)
+{
+    Bytes small(bytes.size() - 1);
+    CHECK(EnumHelper::writeDictionary(small.data(), small.data() + small.size()) == bytes.size());
+    EnumHelper::EnumDictionary dictionary;
+    CHECK(dictionary.attach(bytes.data(), bytes.size()) && dictionary.enumCount() == 3);
+    checkEnum(dictionary, "Color", ColorMagicEnum);
+    checkEnum(dictionary, "Shape", ShapeMagicEnum);
+    checkEnum(dictionary, "Opcode", OpcodeMagicEnum);
+    /* The first enumerator of a value wins, as in the enum itself */
+    CHECK(std::strcmp(dictionary.nameOf("Color", 3), "Red") == 0);
+    CHECK(!dictionary.find("Colour") && !dictionary.find("Colo") && !dictionary.find("") && dictionary.nameOf("Colour", 3) == nullptr);
+}
+
+static void checkDamagedHeaders(const Bytes &bytes)
+{
+    EnumHelper::EnumDictionary dictionary;
+    CHECK(!dictionary.attach(nullptr, bytes.size()));
+    CHECK(!dictionary.attach(bytes.data(), 0));
+    CHECK(!dictionary.attach(bytes.data(), format::HeaderBytes - 1));
+    CHECK(!dictionary.attach(bytes.data(), bytes.size() - 1));
+    CHECK(!dictionary.isOpen() && dictionary.enumCount() == 0 && !dictionary.find("Color"));
+
+    Bytes magic(bytes);
+    magic[0] = 'e';
+    CHECK(!attaches(magic));
+    CHECK(!attaches(patched(bytes, format::VersionAt, format::Version + 1)));
+    CHECK(!attaches(patched(bytes, format::FileSizeAt, bytes.size() + 1)));
+    CHECK(!attaches(patched(bytes, format::SlotCountAt, 0)));
+    CHECK(!attaches(patched(bytes, format::SlotCountAt, 3)));
+    CHECK(!attaches(patched(bytes, format::SlotCountAt, 1u << 30)));
+    CHECK(!attaches(patched(bytes, format::EnumCountAt, 1u << 30)));
+    CHECK(!attaches(patched(bytes, format::HeaderBytes, 4)));
+}
+
+static void checkDamagedRecords(const Bytes &bytes)
+{
+    const size_t recordsAt = format::HeaderBytes + EnumHelper::detail::loadLittleEndian<std::uint32_t>(bytes.data() + format::SlotCountAt) * format::SlotBytes;
+    const size_t entriesAt = EnumHelper::detail::loadLittleEndian<std::uint32_t>(bytes.data() + recordsAt + format::RecordEntriesAt);
+    CHECK(!attaches(patched(bytes, recordsAt + format::RecordNameAt, bytes.size())));
+    CHECK(!attaches(patched(bytes, recordsAt + format::RecordNameLengthAt, bytes.size())));
+    /* A name that runs into the next one has no terminator where the length says */
+    CHECK(!attaches(patched(bytes, recordsAt + format::RecordNameLengthAt, 1)));
+    CHECK(!attaches(patched(bytes, recordsAt + format::RecordEntriesAt, bytes.size())));
+    CHECK(!attaches(patched(bytes, recordsAt + format::RecordEntryCountAt, bytes.size() / format::EntryBytes)));
+    CHECK(!attaches(patched(bytes, recordsAt + format::RecordEntryCountAt, 0xFFFFFFFF)));
+    CHECK(!attaches(patched(bytes, entriesAt + format::EntryNameAt, bytes.size() - 1)));
+    CHECK(!attaches(patched(bytes, entriesAt + format::EntryNameLengthAt, 0xFFFFFFFF)));
+}
+
+/* Cut short anywhere, even with the size field matching, the file is rejected */
+static void checkTruncated(const Bytes &bytes)
+{
+    for (size_t length = format::HeaderBytes; length < bytes.size(); ++length)
+    {
+        Bytes truncated(bytes.begin(), bytes.begin() + length);
+        EnumHelper::detail::storeLittleEndian<std::uint32_t>(truncated.data() + format::FileSizeAt, length);
+        CHECK(!attaches(truncated));
+    }
+}
+
+/* Any single damaged byte is either rejected or leaves every lookup inside the file */
+static void checkFlippedBytes(const Bytes &bytes)
+{
+    const unsigned char flips[] = {0x01, 0x80, 0xFF, 0x5A};
+    for (size_t at = 0; at < bytes.size(); ++at)
+    {
+        for (const unsigned char flip : flips)
+        {
+            Bytes damaged(bytes);
+            damaged[at] ^= flip;
+            EnumHelper::EnumDictionary dictionary;
+            CHECK(!dictionary.attach(damaged.data(), damaged.size()) || namesInside(damaged, dictionary));
+        }
+    }
+}
+
+static void checkOpen(const Bytes &bytes)
+{
+    const char *path = "dictionary_test.bin";
+    FILE *file = std::fopen(path, "wb");
+    CHECK(file != nullptr && std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size() && std::fclose(file) == 0);
+    EnumHelper::EnumDictionary mapped(path);
+    CHECK(mapped.isOpen() && std::strcmp(mapped.nameOf("Shape", 0), "Circle") == 0 && std::strcmp(mapped.nameOf("Opcode", 40), "Add") == 0);
+    mapped.close();
+    CHECK(!mapped.isOpen());
+
+    file = std::fopen(path, "wb");
+    CHECK(file != nullptr && std::fwrite(bytes.data(), 1, bytes.size() / 2, file) == bytes.size() / 2 && std::fclose(file) == 0);
+    CHECK(!mapped.open(path));
+    file = std::fopen(path, "wb");
+    CHECK(file != nullptr && std::fclose(file) == 0);
+    CHECK(!mapped.open(path));
+    std::remove(path);
+    CHECK(!mapped.open(path) && !mapped.isOpen());
+}
+
+int main(int, char *[])
+{
+    const Bytes bytes = writeAll();
+    checkRoundTrip(bytes);
+    checkDamagedHeaders(bytes);
+    checkDamagedRecords(bytes);
+    checkTruncated(bytes);
+    checkFlippedBytes(bytes);
+    checkOpen(bytes);
+    return failures;
+}
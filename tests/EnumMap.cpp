@@ -0,0 +1,102 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#include "EnumHelper.h"
+#include "Check.h"
+#include <cstring>
+#include <string>
+
+/* Compact values get the direct index from lookup::Automatic, Crimson shares the value of Red */
+EnumHelper(Color, Red, Crimson = 0, Green = 1, Blue = 2);
+/* Sparse values only get it from lookup::Dense */
+EnumHelperLookup(Dense, Opcode, Load = 3, Store = 17, Jump = 200, Halt = -40);
+EnumHelper(Sparse, Low = -4000, High = 4000);
+
+static_assert(ColorMagicEnum.hasDirectIndex() && OpcodeMagicEnum.hasDirectIndex(), "both enums have a direct index");
+static_assert(!SparseMagicEnum.hasDirectIndex(), "too sparse for lookup::Automatic");
+
+static void checkLookups()
+{
+    auto map = EnumHelper::makeEnumMap<int>(OpcodeMagicEnum);
+    CHECK(map.size() == 4);
+    for (const auto &entry : map)
+    {
+        CHECK(entry.value == 0);
+    }
+    map[Opcode::Load] = 1;
+    map[Opcode::Jump] += 5;
+    ++map[Opcode::Halt];
+    CHECK(map[Opcode::Load] == 1 && map[Opcode::Store] == 0 && map[Opcode::Jump] == 5 && map[Opcode::Halt] == 1);
+    CHECK(map.atOrdinal(0) == 1 && map.atOrdinal(2) == 5 && map.data()[3] == 1);
+
+    CHECK(map.find(Opcode::Store) == &map.atOrdinal(1) && map.find(Opcode::Halt) == &map.atOrdinal(3));
+    CHECK(map.find(static_cast<Opcode>(4)) == nullptr && map.find(static_cast<Opcode>(-41)) == nullptr && map.find(static_cast<Opcode>(201)) == nullptr);
+    CHECK(map.find(Opcode::Invalid) == nullptr);
+
+    const auto &constant = map;
+    CHECK(constant[Opcode::Jump] == 5 && constant.find(Opcode::Jump) == &map.atOrdinal(2) && constant.find(static_cast<Opcode>(18)) == nullptr);
+}
+
+/* Values without an enumerator all land in the spare slot, which nothing else sees */
+static void checkSpareSlot()
+{
+    auto map = EnumHelper::makeEnumMap<int>(OpcodeMagicEnum);
+    map.fill(7);
+    map[static_cast<Opcode>(100)] = 1000;
+    map[Opcode::Invalid] += 1;
+    map[static_cast<Opcode>(-1000)] += 1;
+    CHECK(map[static_cast<Opcode>(5)] == 1002);
+    int sum = 0;
+    for (const auto &entry : map)
+    {
+        sum += entry.value;
+    }
+    CHECK(sum == 4 * 7);
+    CHECK(map[Opcode::Load] == 7 && map[Opcode::Halt] == 7);
+    /* fill leaves the spare slot alone too */
+    map.fill(0);
+    CHECK(map[Opcode::Invalid] == 1002);
+}
+
+/* Enumerators sharing a value share the slot of the first of them */
+static void checkSharedValues()
+{
+    auto map = EnumHelper::makeEnumMap<int>(ColorMagicEnum);
+    CHECK(map.size() == 4);
+    map[Color::Crimson] = 3;
+    CHECK(map[Color::Red] == 3 && map.atOrdinal(0) == 3 && map.atOrdinal(1) == 0);
+    CHECK(map.find(Color::Crimson) == &map.atOrdinal(0));
+}
+
+static void checkIteration()
+{
+    auto map = EnumHelper::makeEnumMap<std::string>(OpcodeMagicEnum);
+    /* Entries come in table order and their values can be assigned through */
+    for (auto entry : map)
+    {
+        entry.value = entry.key.toString();
+    }
+    std::string names;
+    size_t count = 0;
+    const auto &constant = map;
+    for (const auto &entry : constant)
+    {
+        CHECK(entry.value == entry.key.toString() && entry.key.getValue() == OpcodeMagicEnum.at(count).getValue());
+        names += entry.value;
+        ++count;
+    }
+    CHECK(count == 4 && names == "LoadStoreJumpHalt");
+    CHECK(map[Opcode::Jump] == "Jump");
+}
+
+int main(int, char *[])
+{
+    checkLookups();
+    checkSpareSlot();
+    checkSharedValues();
+    checkIteration();
+    return failures;
+}
@@ -0,0 +1,121 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#include "EnumHelper.h"
+#include "Check.h"
+#include <cstring>
+
+using namespace EnumHelper::enumflags;
+
+/* Invalid comes out as 9, which is not a single flag */
+EnumHelper(Permission, Read = 1, Write = 2, Execute = 4, Delete = 8);
+
+/* The operators must fold to constants, even in C++11 */
+static_assert((Permission::Read | Permission::Write).flags == 3, "operator| must be constexpr");
+static_assert(((Permission::Read | Permission::Write) & Permission::Write).flags == 2, "operator& must be constexpr");
+static_assert(((Permission::Read | Permission::Execute) ^ (Permission::Read | Permission::Write)).flags == 6, "operator^ must be constexpr");
+static_assert((Permission::Read | Permission::Execute).count() == 2 && (Permission::Read | Permission::Execute).test(Permission::Execute), "count and test must be constexpr");
+static_assert(*(Permission::Write | Permission::Execute).begin() == Permission::Write, "iteration must be constexpr");
+static_assert(EnumFlags<Permission>{}.none() && EnumFlags<Permission>{} != EnumFlags<Permission>{Permission::Read}, "default flags must be empty");
+
+static const size_t none = (size_t)(-1);
+
+static size_t parse(const char *text, EnumFlags<Permission> &flags)
+{
+    return parseFlags(PermissionMagicEnum, text, std::strlen(text), flags);
+}
+
+static void testSeparators()
+{
+    EnumFlags<Permission> flags;
+    CHECK(parse("Read|Write", flags) == none && flags == (Permission::Read | Permission::Write));
+    CHECK(parse("Read,Execute", flags) == none && flags == (Permission::Read | Permission::Execute));
+    CHECK(parse("Read|Write,Delete", flags) == none && flags == (Permission::Read | Permission::Write | Permission::Delete));
+    CHECK(parse("Delete", flags) == none && flags == EnumFlags<Permission>(Permission::Delete));
+}
+
+static void testSpacesAndEmptyNames()
+{
+    EnumFlags<Permission> flags;
+    CHECK(parse("  Read | Write ,Delete  ", flags) == none && flags == (Permission::Read | Permission::Write | Permission::Delete));
+    CHECK(parse("Read||,Write|", flags) == none && flags == (Permission::Read | Permission::Write));
+    CHECK(parse("", flags) == none && flags.none());
+    CHECK(parse(" | , ", flags) == none && flags.none());
+    /* A name is never split at a space, only trimmed */
+    CHECK(parse("Re ad", flags) == 0 && flags.none());
+}
+
+static void testUnknownNames()
+{
+    EnumFlags<Permission> flags;
+    /* Known names still count, the offset is that of the first unknown one */
+    CHECK(parse("Read|Bogus|Write|Other", flags) == 5 && flags == (Permission::Read | Permission::Write));
+    CHECK(parse(" Read | Bogus", flags) == 8 && flags == EnumFlags<Permission>(Permission::Read));
+    CHECK(parse("Rea", flags) == 0 && flags.none());
+    CHECK(parse("read", flags) == 0 && flags.none());
+    CHECK(parse("Invalid|Read", flags) == 0 && flags == EnumFlags<Permission>(Permission::Read));
+    CHECK(parse("Write,Invalid", flags) == 6 && flags == EnumFlags<Permission>(Permission::Write));
+    /* Only the first length characters are read */
+    CHECK(parseFlags(PermissionMagicEnum, "Read|Bogus", 4, flags) == none && flags == EnumFlags<Permission>(Permission::Read));
+    /* flags is reset before parsing */
+    flags = Permission::Delete;
+    CHECK(parse("Write", flags) == none && flags == EnumFlags<Permission>(Permission::Write));
+#ifdef USE_STRING_VIEW
+    CHECK(parseFlags(PermissionMagicEnum, std::string_view("Execute|Bogus", 7), flags) == none &&
+          flags == EnumFlags<Permission>(Permission::Execute));
+#endif
+}
+
+static void testToString()
+{
+    char buffer[64];
+    const EnumFlags<Permission> readExecute = Permission::Read | Permission::Execute;
+    CHECK(readExecute.toString(PermissionMagicEnum, buffer, sizeof(buffer)) == 12 && std::strcmp(buffer, "Read|Execute") == 0);
+    CHECK(readExecute.toString(PermissionMagicEnum, buffer, sizeof(buffer), ", ") == 13 && std::strcmp(buffer, "Read, Execute") == 0);
+    CHECK(EnumFlags<Permission>{}.toString(PermissionMagicEnum, buffer, sizeof(buffer)) == 0 && buffer[0] == '\0');
+    /* A bit without an enumerator is named Invalid */
+    CHECK(EnumFlags<Permission>{static_cast<Permission>(16 | 2)}.toString(PermissionMagicEnum, buffer, sizeof(buffer)) == 13 &&
+          std::strcmp(buffer, "Write|Invalid") == 0);
+}
+
+static void testTruncation()
+{
+    const EnumFlags<Permission> readExecute = Permission::Read | Permission::Execute;
+    char buffer[16];
+    /* The full length comes back, the buffer holds what fits and a NUL */
+    std::memset(buffer, 'x', sizeof(buffer));
+    CHECK(readExecute.toString(PermissionMagicEnum, buffer, 6) == 12 && std::strcmp(buffer, "Read|") == 0 && buffer[6] == 'x');
+    CHECK(readExecute.toString(PermissionMagicEnum, buffer, 12) == 12 && std::strcmp(buffer, "Read|Execut") == 0);
+    CHECK(readExecute.toString(PermissionMagicEnum, buffer, 1) == 12 && buffer[0] == '\0');
+    /* Size 0 writes nothing at all */
+    std::memset(buffer, 'x', sizeof(buffer));
+    CHECK(readExecute.toString(PermissionMagicEnum, buffer, 0) == 12 && buffer[0] == 'x');
+}
+
+static void testRoundTrip()
+{
+    char buffer[64];
+    for (unsigned mask = 0; mask < 16; ++mask)
+    {
+        const EnumFlags<Permission> original{static_cast<Permission>(mask)};
+        EnumFlags<Permission> parsed;
+        const size_t length = original.toString(PermissionMagicEnum, buffer, sizeof(buffer));
+        CHECK(parseFlags(PermissionMagicEnum, buffer, length, parsed) == none && parsed == original);
+        original.toString(PermissionMagicEnum, buffer, sizeof(buffer), " , ");
+        CHECK(parse(buffer, parsed) == none && parsed == original);
+    }
+}
+
+int main(int, char *[])
+{
+    testSeparators();
+    testSpacesAndEmptyNames();
+    testUnknownNames();
+    testToString();
+    testTruncation();
+    testRoundTrip();
+    return failures;
+}
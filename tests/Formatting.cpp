@@ -0,0 +1,122 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+/* The fmt formatter is only declared when fmt comes first, header only so the test links against nothing */
+#if __cplusplus >= 201402L && defined(__has_include)
+#if __has_include(<fmt/format.h>)
+#define FMT_HEADER_ONLY
+#include <fmt/format.h>
+#endif
+#endif
+#include "EnumHelper.h"
+#include "Check.h"
+#include <climits>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+EnumHelper(Color, Red = 3, Green = -9, Blue = 400);
+
+/* The extremes of int, Invalid takes the value after Highest */
+EnumHelper(Extreme, Lowest = INT_MIN, Highest = INT_MAX - 1);
+
+#ifdef USE_RELAXED_CONSTEXPR
+/* Longer than the stack buffer of the pooled operator<< */
+EnumHelperPooled(Pooled, Short = 5, AVeryLongEnumeratorNameThatDoesNotFitTheSixtyFourByteBufferOfOperatorShift = -1);
+#endif
+
+/* Formats pair into exactly size bytes, the text when it fit and "<null>" when toChars gave up */
+template <typename Pair>
+static std::string toChars(const Pair &pair, size_t size)
+{
+    char buffer[256];
+    std::memset(buffer, 'x', sizeof(buffer));
+    const char *end = EnumHelper::toChars(buffer, buffer + size, pair);
+    /* Nothing past the end may be touched, fit or not */
+    CHECK(buffer[size] == 'x');
+    return (end == nullptr) ? "<null>" : std::string(static_cast<const char *>(buffer), end);
+}
+
+template <typename Pair>
+static std::string streamed(const Pair &pair)
+{
+    std::ostringstream stream;
+    stream << pair;
+    return stream.str();
+}
+
+static void checkToChars()
+{
+    CHECK(toChars(ColorMagicEnum(Color::Green), 9) == "Green(-9)");
+    CHECK(toChars(ColorMagicEnum(Color::Green), 8) == "<null>");
+    CHECK(toChars(ColorMagicEnum(Color::Blue), 100) == "Blue(400)");
+    CHECK(toChars(ColorMagicEnum(Color::Red), 0) == "<null>");
+    /* A value without an enumerator formats as the Invalid entry, Invalid is one past the last value */
+    CHECK(toChars(ColorMagicEnum(static_cast<Color>(77)), 12) == "Invalid(401)");
+    CHECK(toChars(ColorMagicEnum(static_cast<Color>(77)), 11) == "<null>");
+    CHECK(toChars(ExtremeMagicEnum(Extreme::Lowest), 19) == "Lowest(-2147483648)");
+    CHECK(toChars(ExtremeMagicEnum(Extreme::Highest), 20) == "Highest(2147483646)");
+    CHECK(toChars(ExtremeMagicEnum(Extreme::Invalid), 20) == "Invalid(2147483647)");
+
+    char buffer[16];
+    char *end = EnumHelper::nameToChars(buffer, buffer + 5, ColorMagicEnum(Color::Green));
+    CHECK(end == buffer + 5 && std::memcmp(buffer, "Green", 5) == 0);
+    CHECK(EnumHelper::nameToChars(buffer, buffer + 4, ColorMagicEnum(Color::Green)) == nullptr);
+    end = EnumHelper::valueToChars(buffer, buffer + 2, ColorMagicEnum(Color::Green));
+    CHECK(end == buffer + 2 && std::memcmp(buffer, "-9", 2) == 0);
+    CHECK(EnumHelper::valueToChars(buffer, buffer + 1, ColorMagicEnum(Color::Green)) == nullptr);
+}
+
+static void checkStream()
+{
+    CHECK(streamed(ColorMagicEnum(Color::Green)) == "Green(-9)");
+    CHECK(streamed(ColorMagicEnum(static_cast<Color>(77))) == "Invalid(401)");
+    CHECK(streamed(ExtremeMagicEnum(Extreme::Lowest)) == "Lowest(-2147483648)");
+    std::ostringstream stream;
+    stream << ColorMagicEnum(Color::Red) << ',' << ColorMagicEnum(Color::Blue);
+    CHECK(stream.str() == "Red(3),Blue(400)");
+#ifdef USE_RELAXED_CONSTEXPR
+    CHECK(streamed(PooledMagicEnum(Pooled::Short)) == "Short(5)");
+    CHECK(streamed(PooledMagicEnum(Pooled::AVeryLongEnumeratorNameThatDoesNotFitTheSixtyFourByteBufferOfOperatorShift)) ==
+          "AVeryLongEnumeratorNameThatDoesNotFitTheSixtyFourByteBufferOfOperatorShift(-1)");
+    CHECK(toChars(PooledMagicEnum(Pooled::Short), 8) == "Short(5)" && toChars(PooledMagicEnum(Pooled::Short), 7) == "<null>");
+#endif
+}
+
+static void checkFormatters()
+{
+#ifdef USE_STD_FORMAT
+    CHECK(std::format("{}", ColorMagicEnum(Color::Green)) == "Green(-9)");
+    CHECK(std::format("{:n}|{:v}", ColorMagicEnum(Color::Green), ColorMagicEnum(Color::Green)) == "Green|-9");
+    CHECK(std::format("{}", ColorMagicEnum(static_cast<Color>(77))) == "Invalid(401)");
+    CHECK(std::format("{:n}", PooledMagicEnum(Pooled::Short)) == "Short");
+#endif
+#ifdef USE_FMT_FORMAT
+    CHECK(fmt::format("{}", ColorMagicEnum(Color::Green)) == "Green(-9)");
+    CHECK(fmt::format("{:n}|{:v}", ColorMagicEnum(Color::Green), ColorMagicEnum(Color::Green)) == "Green|-9");
+    CHECK(fmt::format("{}", ColorMagicEnum(static_cast<Color>(77))) == "Invalid(401)");
+    CHECK(fmt::format("{:v}", ExtremeMagicEnum(Extreme::Lowest)) == "-2147483648");
+    CHECK(fmt::format("{:n}", PooledMagicEnum(Pooled::Short)) == "Short");
+    bool rejected = false;
+    try
+    {
+        (void)fmt::format(fmt::runtime("{:x}"), ColorMagicEnum(Color::Red));
+    }
+    catch (const fmt::format_error &)
+    {
+        rejected = true;
+    }
+    CHECK(rejected);
+#endif
+}
+
+int main(int, char *[])
+{
+    checkToChars();
+    checkStream();
+    checkFormatters();
+    return failures;
+}
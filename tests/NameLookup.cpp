@@ -0,0 +1,102 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#include "EnumHelper.h"
+#include "Check.h"
+#include <cstring>
+#include <string>
+
+EnumHelper(Color, Red, Green, Blue);
+/* Names that share lengths, first characters and letters, the cases a weak hash or prefilter gets wrong */
+EnumHelperLookup(Hash, Similar, A, B, AB, BA, ABC, ACB, BAC, aa, Aa, aA, Ab, AbC);
+EnumHelperLookup(Binary, SortedSimilar, A, B, AB, BA, ABC, ACB, BAC, aa, Aa, aA, Ab, AbC);
+EnumHelperLookup(Linear, ScannedSimilar, A, B, AB, BA, ABC, ACB, BAC, aa, Aa, aA, Ab, AbC);
+EnumHelperLookup(Dense, Sparse, Low = -40, Zero = 0, High = 90, Higher = 91);
+
+#define ENUM_HELPER_TEN(prefix) prefix##0, prefix##1, prefix##2, prefix##3, prefix##4, prefix##5, prefix##6, prefix##7, prefix##8, prefix##9
+#define ENUM_HELPER_HUNDRED(prefix)                                                                                                     \
+    ENUM_HELPER_TEN(prefix##0), ENUM_HELPER_TEN(prefix##1), ENUM_HELPER_TEN(prefix##2), ENUM_HELPER_TEN(prefix##3),                 \
+        ENUM_HELPER_TEN(prefix##4), ENUM_HELPER_TEN(prefix##5), ENUM_HELPER_TEN(prefix##6), ENUM_HELPER_TEN(prefix##7),             \
+        ENUM_HELPER_TEN(prefix##8), ENUM_HELPER_TEN(prefix##9)
+/* 250 enumerators, N100 to N349, more than a scan handles */
+EnumHelper(Large, ENUM_HELPER_HUNDRED(N1), ENUM_HELPER_HUNDRED(N2), ENUM_HELPER_TEN(N30), ENUM_HELPER_TEN(N31), ENUM_HELPER_TEN(N32),
+           ENUM_HELPER_TEN(N33), ENUM_HELPER_TEN(N34));
+
+#ifdef USE_RELAXED_CONSTEXPR
+EnumHelperLookup(CaseInsensitive, Folded, Red, GREEN, blue, Yellow2);
+EnumHelperPooled(Pooled, First = 7, Second = 3, Third = 1000);
+
+/* Compile-time lookups go through the index the constructor built */
+static_assert(ColorMagicEnum("Green").getValue() == Color::Green, "constexpr name lookup");
+static_assert(SimilarMagicEnum("AbC").getValue() == Similar::AbC, "constexpr name lookup");
+static_assert(SimilarMagicEnum("Abc").getValue() == Similar::Invalid, "constexpr name miss");
+static_assert(LargeMagicEnum("N277").getValue() == Large::N277, "constexpr name lookup");
+static_assert(FoldedMagicEnum("yellow2").getValue() == Folded::Yellow2, "constexpr folded name lookup");
+#endif
+
+static const size_t none = (size_t)(-1);
+
+/* Every name must find its own entry, whether NUL terminated, a slice of a longer string or a copy */
+template <typename Magic>
+static void checkEveryName(const Magic &magic)
+{
+    for (size_t index = 0; index < magic.size(); ++index)
+    {
+        const char *name = magic.at(index).toString();
+        const size_t length = std::strlen(name);
+        const std::string copy(name);
+        const std::string longer = copy + "Tail";
+        CHECK(magic.indexOf(name) == index);
+        CHECK(magic.indexOf(copy.c_str()) == index);
+        CHECK(magic.indexOfSlice(longer.c_str(), length) == index);
+        CHECK(magic(copy.c_str()).getValue() == magic.at(index).getValue());
+        CHECK(magic.indexOf(longer.c_str()) == none);
+    }
+}
+
+template <typename Magic>
+static void checkMisses(const Magic &magic, const char *const *names, size_t count)
+{
+    for (size_t name = 0; name < count; ++name)
+    {
+        CHECK(magic.indexOf(names[name]) == none);
+        CHECK(magic.indexOfSlice(names[name], std::strlen(names[name])) == none);
+        CHECK(magic(names[name]).getValue() == magic.at(magic.size()).getValue());
+    }
+}
+
+int main(int, char *[])
+{
+    checkEveryName(ColorMagicEnum);
+    checkEveryName(SimilarMagicEnum);
+    checkEveryName(SortedSimilarMagicEnum);
+    checkEveryName(ScannedSimilarMagicEnum);
+    checkEveryName(SparseMagicEnum);
+    checkEveryName(LargeMagicEnum);
+
+    const char *const misses[] = {"", "red", "Gree", "Greens", "C", "BB", "ABCD", "abc", "N99", "N350", "N1000"};
+    const size_t missCount = sizeof(misses) / sizeof(misses[0]);
+    checkMisses(ColorMagicEnum, misses, missCount);
+    checkMisses(SimilarMagicEnum, misses, missCount);
+    checkMisses(SortedSimilarMagicEnum, misses, missCount);
+    checkMisses(ScannedSimilarMagicEnum, misses, missCount);
+    checkMisses(SparseMagicEnum, misses, missCount);
+    checkMisses(LargeMagicEnum, misses, missCount);
+
+#ifdef USE_RELAXED_CONSTEXPR
+    checkEveryName(PooledMagicEnum);
+    checkMisses(PooledMagicEnum, misses, missCount);
+    checkEveryName(FoldedMagicEnum);
+    const char *const folded[] = {"red", "RED", "green", "Green", "BLUE", "Blue", "yELLOW2", "YELLOW2"};
+    for (size_t name = 0; name < sizeof(folded) / sizeof(folded[0]); ++name)
+    {
+        CHECK(FoldedMagicEnum.indexOf(folded[name]) == name / 2);
+    }
+    const char *const foldedMisses[] = {"", "Yellow", "yellow3", "Re", "blue "};
+    checkMisses(FoldedMagicEnum, foldedMisses, sizeof(foldedMisses) / sizeof(foldedMisses[0]));
+#endif
+    return failures;
+}
@@ -0,0 +1,129 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#include "EnumHelper.h"
+#include "Check.h"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/* Sparse and negative values, few enough that Automatic scans the value column */
+EnumHelper(Scanned, M1 = -1, M2 = -2, M128 = -128, M129 = -129, Z = 0, P1 = 1, P127 = 127, P128 = 128, P255 = 255, P256 = 256, P257 = 257,
+           P4096 = 4096, P65535 = 65535, P65536 = 65536, P70000 = 70000, P99999 = 99999, Big = 0x40000000, Small = -0x40000000);
+
+using EnumHelper::detail::scanValues;
+
+static std::mt19937 generator(42);
+
+/* The vector scan must find what the plain loop finds, at every count around the register widths */
+template <typename T>
+static void checkScan(const std::vector<T> &domain)
+{
+    std::vector<T> values(80);
+    for (size_t count = 0; count <= values.size(); ++count)
+    {
+        for (int fill = 0; fill < 8; ++fill)
+        {
+            for (size_t element = 0; element < count; ++element)
+            {
+                values[element] = domain[generator() % domain.size()];
+            }
+            for (const T value : domain)
+            {
+                CHECK(scanValues(values.data(), count, value) == scanValues(values.data(), count, value, std::false_type()));
+            }
+        }
+    }
+}
+
+/* A single hit at every position, including the overlapping tail register */
+template <typename T>
+static void checkEveryPosition(T hit, T other)
+{
+    std::vector<T> values(80, other);
+    for (size_t count = 1; count <= values.size(); ++count)
+    {
+        for (size_t position = 0; position < count; ++position)
+        {
+            values[position] = hit;
+            CHECK(scanValues(values.data(), count, hit) == position);
+            values[position] = other;
+        }
+        CHECK(scanValues(values.data(), count, hit) == count);
+    }
+}
+
+/* The slot compares must agree with the byte loop for every length and every differing byte */
+template <size_t Width>
+static void checkSameBytes()
+{
+    char slot[Width];
+    char name[Width];
+    for (size_t character = 0; character < Width; ++character)
+    {
+        slot[character] = name[character] = static_cast<char>('A' + generator() % 26);
+    }
+    for (size_t length = 0; length <= Width; ++length)
+    {
+        CHECK(EnumHelper::detail::sameBytes<Width>(slot, name, length));
+        for (size_t differing = 0; differing < Width; ++differing)
+        {
+            name[differing] ^= 0x20;
+            CHECK(EnumHelper::detail::sameBytes<Width>(slot, name, length) == EnumHelper::detail::sameBytesScalar(slot, name, length));
+            CHECK(EnumHelper::detail::sameBytes<Width>(slot, name, length) == (differing >= length));
+            name[differing] ^= 0x20;
+        }
+    }
+}
+
+/* Value lookups through the scanned column against a walk over the table */
+static void checkMagicEnum()
+{
+    std::vector<Scanned> input;
+    for (long long value = -300; value <= 70000; value += (value < 300) ? 1 : 97)
+    {
+        input.push_back(static_cast<Scanned>(value));
+    }
+    for (size_t index = 0; index < ScannedMagicEnum.size(); ++index)
+    {
+        input.push_back(ScannedMagicEnum.at(index).getValue());
+    }
+    std::vector<size_t> indices(input.size());
+    ScannedMagicEnum.indicesOf(input.data(), input.size(), indices.data());
+    for (size_t element = 0; element < input.size(); ++element)
+    {
+        size_t expected = (size_t)(-1);
+        for (size_t index = 0; index < ScannedMagicEnum.size() && expected == (size_t)(-1); ++index)
+        {
+            expected = (ScannedMagicEnum.at(index).getValue() == input[element]) ? index : expected;
+        }
+        CHECK(ScannedMagicEnum.indexOf(input[element]) == expected);
+        CHECK(indices[element] == expected);
+    }
+}
+
+int main(int, char *[])
+{
+    checkScan<std::int8_t>({-128, -1, 0, 1, 127});
+    checkScan<std::uint8_t>({0, 1, 128, 255});
+    checkScan<std::int16_t>({-32768, -256, -1, 0, 255, 256, 32767});
+    checkScan<std::uint16_t>({0, 1, 256, 257, 65535});
+    checkScan<std::int32_t>({-2147483647 - 1, -65536, -1, 0, 65535, 65536, 2147483647});
+    checkScan<std::int64_t>({-1, 0, 1, 4294967296LL});
+
+    checkEveryPosition<std::int8_t>(-1, 0);
+    checkEveryPosition<std::int8_t>(0, -1);
+    checkEveryPosition<std::int16_t>(256, 1);
+    checkEveryPosition<std::uint16_t>(1, 256);
+    checkEveryPosition<std::int32_t>(65536, 1);
+    checkEveryPosition<std::int32_t>(-1, 0x7fffffff);
+
+    checkSameBytes<16>();
+    checkSameBytes<32>();
+
+    checkMagicEnum();
+    return failures;
+}
@@ -0,0 +1,95 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+#define ENUM_HELPER_STATISTICS
+#include "EnumHelper.h"
+#include "Check.h"
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+EnumHelper(Color, Red = 3, Green = -9, Blue = 400);
+EnumHelperLookup(Binary, Shape, Circle, Square, Triangle);
+
+/* Evaluated by the compiler, which must not count */
+constexpr Color compiledGreen = ColorMagicEnum("Green").getValue();
+static_assert(compiledGreen == Color::Green, "constexpr lookup");
+
+static bool counted(const EnumHelper::LookupStatistics &statistics, std::uint64_t lookups, std::uint64_t misses, std::uint64_t invalids)
+{
+    return statistics.lookups() == lookups && statistics.misses() == misses && statistics.invalids() == invalids;
+}
+
+static void checkValueLookups()
+{
+    ColorStatistics.reset();
+    CHECK(counted(ColorStatistics, 0, 0, 0));
+    (void)ColorMagicEnum(Color::Red);
+    (void)ColorMagicEnum(Color::Blue);
+    CHECK(counted(ColorStatistics, 2, 0, 0));
+    /* A value without an enumerator is a miss, Invalid itself only an invalid */
+    (void)ColorMagicEnum(static_cast<Color>(77));
+    CHECK(counted(ColorStatistics, 3, 1, 1));
+    (void)ColorMagicEnum(Color::Invalid);
+    CHECK(counted(ColorStatistics, 4, 1, 2));
+    CHECK(ColorMagicEnum.ordinalOf(Color::Green) == 1 && ColorMagicEnum.ordinalOf(static_cast<Color>(5)) == 3);
+    CHECK(counted(ColorStatistics, 6, 2, 3));
+}
+
+static void checkNameLookups()
+{
+    ColorStatistics.reset();
+    (void)ColorMagicEnum("Green");
+    (void)ColorMagicEnum("Purple");
+    (void)ColorMagicEnum("Invalid");
+    CHECK(counted(ColorStatistics, 3, 1, 2));
+    (void)ColorMagicEnum("BlueTail", 4);
+    (void)ColorMagicEnum(std::string_view("Gre"));
+    CHECK(counted(ColorStatistics, 5, 2, 3));
+
+    /* One lookup per name of a bulk conversion */
+    const char *const names[] = {"Red", "Mauve", "Blue", "Teal"};
+    Color values[4];
+    std::uint64_t errors[1];
+    CHECK(ColorMagicEnum.valuesOf(names, 4, values, errors) == 2 && errors[0] == 0xA);
+    CHECK(counted(ColorStatistics, 9, 4, 5));
+}
+
+static void checkEnumsApart()
+{
+    EnumHelper::resetStatistics();
+    (void)ShapeMagicEnum("Square");
+    (void)ShapeMagicEnum("Hexagon");
+    (void)ColorMagicEnum(Color::Red);
+    CHECK(counted(ShapeStatistics, 2, 1, 1));
+    CHECK(counted(ColorStatistics, 1, 0, 0));
+
+    size_t seen = 0;
+    EnumHelper::scrapeStatistics([&seen](EnumHelper::LookupStatistics &statistics) {
+        if (std::strcmp(statistics.name(), "Shape") == 0)
+        {
+            CHECK(counted(statistics, 2, 1, 1));
+            ++seen;
+        }
+        else if (std::strcmp(statistics.name(), "Color") == 0)
+        {
+            CHECK(counted(statistics, 1, 0, 0));
+            ++seen;
+        }
+    });
+    CHECK(seen == 2);
+
+    EnumHelper::resetStatistics();
+    CHECK(counted(ShapeStatistics, 0, 0, 0) && counted(ColorStatistics, 0, 0, 0));
+}
+
+int main(int, char *[])
+{
+    checkValueLookups();
+    checkNameLookups();
+    checkEnumsApart();
+    return failures;
+}
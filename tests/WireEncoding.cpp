@@ -0,0 +1,134 @@
+/*
+* EnumHelper version 0.1.0
+* Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+* SPDX-License-Identifier: MIT
+* Copyright (c) 2018 - 2022 Patrik Olesen <patrik@hemma.org>
+*/
+/* Large needs more than the default 256 entries */
+#define ENUM_HELPER_MAX_ENUMERATORS 1024
+#include "EnumHelper.h"
+#include "Check.h"
+#include <vector>
+
+EnumHelper(Color, Red = 3, Green = -9, Blue = 400);
+
+#define ENUM_HELPER_TEN(prefix) prefix##0, prefix##1, prefix##2, prefix##3, prefix##4, prefix##5, prefix##6, prefix##7, prefix##8, prefix##9
+#define ENUM_HELPER_HUNDRED(prefix)                                                                                                     \
+    ENUM_HELPER_TEN(prefix##0), ENUM_HELPER_TEN(prefix##1), ENUM_HELPER_TEN(prefix##2), ENUM_HELPER_TEN(prefix##3),                 \
+        ENUM_HELPER_TEN(prefix##4), ENUM_HELPER_TEN(prefix##5), ENUM_HELPER_TEN(prefix##6), ENUM_HELPER_TEN(prefix##7),             \
+        ENUM_HELPER_TEN(prefix##8), ENUM_HELPER_TEN(prefix##9)
+/* 256 enumerators and Invalid, one entry too many for one byte ordinals */
+EnumHelper(Large, ENUM_HELPER_HUNDRED(N1), ENUM_HELPER_HUNDRED(N2), ENUM_HELPER_TEN(N30), ENUM_HELPER_TEN(N31), ENUM_HELPER_TEN(N32),
+           ENUM_HELPER_TEN(N33), ENUM_HELPER_TEN(N34), N350, N351, N352, N353, N354, N355);
+
+#ifdef USE_RELAXED_CONSTEXPR
+/* The same schema declared elsewhere, and one change each from it */
+namespace same
+{
+EnumHelper(Color, Red = 3, Green = -9, Blue = 400);
+EnumHelperPooled(Pooled, Red = 3, Green = -9, Blue = 400);
+}
+namespace renamed
+{
+EnumHelper(Color, Red = 3, Lime = -9, Blue = 400);
+}
+namespace reordered
+{
+EnumHelper(Color, Green = -9, Red = 3, Blue = 400);
+}
+namespace revalued
+{
+EnumHelper(Color, Red = 3, Green = -8, Blue = 400);
+}
+namespace extended
+{
+EnumHelper(Color, Red = 3, Green = -9, Blue = 400, Cyan = 401);
+}
+
+static_assert(ColorMagicEnum.fingerprint() == same::ColorMagicEnum.fingerprint(), "same schema, same fingerprint");
+static_assert(ColorMagicEnum.fingerprint() == same::PooledMagicEnum.fingerprint(), "the layout is not part of the schema");
+static_assert(ColorMagicEnum.fingerprint() != renamed::ColorMagicEnum.fingerprint(), "a renamed enumerator changes the fingerprint");
+static_assert(ColorMagicEnum.fingerprint() != reordered::ColorMagicEnum.fingerprint(), "reordered enumerators change the fingerprint");
+static_assert(ColorMagicEnum.fingerprint() != revalued::ColorMagicEnum.fingerprint(), "a changed value changes the fingerprint");
+static_assert(ColorMagicEnum.fingerprint() != extended::ColorMagicEnum.fingerprint(), "an added enumerator changes the fingerprint");
+#endif
+
+static_assert(ColorMagicEnum.ordinalBytes() == 1, "four entries fit one byte");
+static_assert(LargeMagicEnum.ordinalBytes() == 2, "257 entries need two bytes");
+
+template <typename Magic>
+static void checkRoundTrip(const Magic &magic)
+{
+    using Value = decltype(magic.at(0).getValue());
+    std::vector<unsigned char> bytes(magic.ordinalBytes());
+    for (size_t index = 0; index < magic.size(); ++index)
+    {
+        Value value = magic.at((index + 1) % magic.size()).getValue();
+        CHECK(magic.encode(magic.at(index).getValue(), bytes.data(), bytes.data() + bytes.size()) == bytes.data() + bytes.size());
+        CHECK(magic.decode(bytes.data(), bytes.data() + bytes.size(), value) == bytes.data() + bytes.size());
+        CHECK(value == magic.at(index).getValue() && magic.ordinalOf(value) == index && magic.fromOrdinal(index).getValue() == value);
+    }
+
+    /* Every enumerator and one value without one, in bulk */
+    std::vector<Value> values;
+    for (size_t index = 0; index < magic.size(); ++index)
+    {
+        values.push_back(magic.at(magic.size() - 1 - index).getValue());
+    }
+    values.push_back(static_cast<Value>(-1000));
+    bytes.assign(values.size() * magic.ordinalBytes(), 0);
+    CHECK(magic.encodeAll(values.data(), values.size(), bytes.data()) == 1);
+    std::vector<Value> decoded(values.size());
+    CHECK(magic.decodeAll(bytes.data(), values.size(), decoded.data()) == 0);
+    for (size_t element = 0; element + 1 < values.size(); ++element)
+    {
+        CHECK(decoded[element] == values[element]);
+    }
+    CHECK(decoded.back() == magic.at(magic.size()).getValue());
+}
+
+static void checkColorBytes()
+{
+    unsigned char bytes[4] = {0xEE, 0xEE, 0xEE, 0xEE};
+    /* One byte each, in table order, a value without an enumerator goes out as Invalid */
+    CHECK(ColorMagicEnum.encode(Color::Blue, bytes, bytes + 4) == bytes + 1 && bytes[0] == 2 && bytes[1] == 0xEE);
+    CHECK(ColorMagicEnum.encode(static_cast<Color>(77), bytes, bytes + 4) == bytes + 1 && bytes[0] == 3);
+    CHECK(ColorMagicEnum.encode(Color::Red, bytes, bytes) == nullptr && bytes[0] == 3);
+
+    /* Ordinals past the table decode as Invalid, and decodeAll counts them */
+    Color value = Color::Red;
+    const unsigned char pastTable[] = {4, 255, 1};
+    CHECK(ColorMagicEnum.decode(pastTable, pastTable + 1, value) == pastTable + 1 && value == Color::Invalid);
+    CHECK(ColorMagicEnum.fromOrdinal(255).getValue() == Color::Invalid);
+    Color values[3];
+    CHECK(ColorMagicEnum.decodeAll(pastTable, 3, values) == 2 && values[0] == Color::Invalid && values[1] == Color::Invalid && values[2] == Color::Green);
+    /* Too few bytes leave the value alone */
+    value = Color::Blue;
+    CHECK(ColorMagicEnum.decode(pastTable, pastTable, value) == nullptr && value == Color::Blue);
+}
+
+static void checkLargeBytes()
+{
+    /* Two bytes, little endian whatever the machine */
+    unsigned char bytes[2] = {};
+    CHECK(LargeMagicEnum.encode(Large::N355, bytes, bytes + 2) == bytes + 2 && bytes[0] == 0xFF && bytes[1] == 0x00);
+    CHECK(LargeMagicEnum.encode(Large::Invalid, bytes, bytes + 2) == bytes + 2 && bytes[0] == 0x00 && bytes[1] == 0x01);
+    CHECK(LargeMagicEnum.encode(Large::N100, bytes, bytes + 1) == nullptr);
+
+    Large value = Large::N100;
+    const unsigned char truncated[] = {0x01};
+    CHECK(LargeMagicEnum.decode(truncated, truncated + 1, value) == nullptr && value == Large::N100);
+    const unsigned char pastTable[] = {0x01, 0x01};
+    CHECK(LargeMagicEnum.decode(pastTable, pastTable + 2, value) == pastTable + 2 && value == Large::Invalid);
+    const unsigned char lowByteFirst[] = {0x02, 0x00};
+    CHECK(LargeMagicEnum.decode(lowByteFirst, lowByteFirst + 2, value) == lowByteFirst + 2 && value == Large::N102);
+}
+
+int main(int, char *[])
+{
+    checkRoundTrip(ColorMagicEnum);
+    checkRoundTrip(LargeMagicEnum);
+    checkColorBytes();
+    checkLargeBytes();
+    return failures;
+}